@@ -5,6 +5,7 @@
 #include <memory>
 #include <optional>
 #include <SFML/Audio.hpp>
+#include "resource_handle.hpp"
 
 namespace engine::resource {
     class ResourceManager;
@@ -36,6 +37,17 @@ public:
      */
     sf::Sound* play_sound(std::string_view sound_path, bool loop = false, std::optional<float> volume = std::nullopt);
 
+    /**
+     * @brief 通过预先解析的句柄播放音效（运行时无字符串查找）
+     * @param sound 音效句柄，由 get_sound_handle() 获得
+     */
+    sf::Sound* play_sound(engine::resource::SoundHandle sound, bool loop = false, std::optional<float> volume = std::nullopt);
+
+    /**
+     * @brief 解析音效路径对应的句柄（转发给 ResourceManager）
+     */
+    engine::resource::SoundHandle get_sound_handle(std::string_view sound_path);
+
     /**
      * @brief 设置所有音效的全局音量
      */
@@ -63,6 +75,8 @@ public:
     float get_music_volume() const;
 
 private:
+    sf::Sound* play_buffer(const sf::SoundBuffer& buffer, bool loop, std::optional<float> volume);     ///< @brief 创建并播放音效实例
+
     engine::resource::ResourceManager* resource_manager_obs_;
 
     // 正在播放的音效实例（用于控制音量、暂停等）
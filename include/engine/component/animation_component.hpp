@@ -1,12 +1,16 @@
 #pragma once
 #include "component.hpp"
+#include "animation_id.hpp"
+#include "animation_system.hpp"
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <string_view>
-#include <unordered_map>
-#include <memory>
+#include <vector>
 
 namespace engine::render {
     class Animation;
+    class AnimationSystem;
 } // namespace engine::render
 
 namespace engine::component {
@@ -17,13 +21,20 @@ namespace engine::component {
 /**
  * @brief GameObject的动画组件。
  *
- * 持有一组Animation对象并控制其播放，
- * 根据当前帧更新关联的SpriteComponent。
+ * 持有指向共享动画片段（AnimationLibrary）的非拥有指针，控制其播放。
+ * 播放期间计时器与帧游标存放在场景的 AnimationSystem 中，由系统批量推进并更新关联的SpriteComponent；
+ * 组件自身的 update 不做任何事。
  */
 class AnimationComponent : public Component {
     friend class engine::object::GameObject;
+    friend class engine::render::AnimationSystem;
 public:
-    AnimationComponent(engine::object::GameObject* owner);
+    /**
+     * @brief 构造函数
+     * @param owner 所属 GameObject
+     * @param animation_system 推进动画的系统（通常为所在场景的 AnimationSystem），不能为空
+     */
+    AnimationComponent(engine::object::GameObject* owner, engine::render::AnimationSystem* animation_system);
     ~AnimationComponent() override;
 
     // 删除复制/移动操作
@@ -32,30 +43,51 @@ public:
     AnimationComponent(AnimationComponent&&) = delete;
     AnimationComponent& operator=(AnimationComponent&&) = delete;
 
-    void add_animation(std::unique_ptr<engine::render::Animation> animation);   ///< @brief 向 animations_ map容器中添加一个动画。
-    void play_animation(std::string_view name);                                 ///< @brief 播放指定名称的动画。
-    void stop_animation() { is_playing_ = false; }                              ///< @brief 停止当前动画播放。
-    void resume_animation() {is_playing_ = true; }                              ///< @brief 恢复当前动画播放。
+    void add_animation(const engine::render::Animation* animation);             ///< @brief 添加一个动画片段（非拥有，片段须比组件活得久，通常来自 AnimationLibrary）。同名片段会被替换。
+    void play_animation(engine::render::AnimationId id);                        ///< @brief 播放指定 id 的动画（只做整数比较，适合每帧调用）。
+    void play_animation(std::string_view name);                                 ///< @brief 播放指定名称的动画（逐个比较名称，适合偶尔调用）。
+    void stop_animation();                                                      ///< @brief 停止当前动画播放（保留进度，归还系统槽位）。
+    void resume_animation();                                                    ///< @brief 从停止处恢复当前动画播放。
 
     // --- Getters and Setters ---
     std::string_view get_current_animation_name() const;
-    bool is_playing() const { return is_playing_; }
+    engine::render::AnimationId get_current_animation_id() const;
+    bool is_playing() const { return state_index_ != INVALID_STATE; }
     bool is_animation_finished() const;
     bool is_one_shot_removal() const { return is_one_shot_removal_; }
     void set_one_shot_removal(bool is_one_shot_removal) { is_one_shot_removal_ = is_one_shot_removal; }
 
 protected:
-    // 核心循环方法
-    void update(sf::Time delta, engine::core::Context& context) override;
+    // 核心循环方法（动画由 AnimationSystem 统一推进，这里为空）
+    void update(sf::Time, engine::core::Context&) override {}
 
 private:
-    /// @brief 动画名称到Animation对象的映射。
-    std::unordered_map<std::string, std::unique_ptr<engine::render::Animation>> animations_;
-    SpriteComponent* sprite_component_obs_ = nullptr;               ///< @brief 指向必需的SpriteComponent的指针
-    engine::render::Animation* current_animation_obs_ = nullptr;    ///< @brief 指向当前播放动画的原始指针
+    /// @brief 已添加的动画片段条目：id 与片段指针（非拥有）紧挨着存放
+    struct Clip {
+        engine::render::AnimationId id;
+        const engine::render::Animation* animation = nullptr;
+    };
 
-    sf::Time animation_timer_ = sf::Time::Zero;         ///< @brief 动画播放中的计时器
-    bool is_playing_ = false;                           ///< @brief 当前是否有动画正在播放
+    static constexpr uint32_t INVALID_STATE = std::numeric_limits<uint32_t>::max();
+
+    /// @brief 切换到指定片段并立即显示第一帧
+    void start_animation(const engine::render::Animation* animation);
+    /// @brief 以当前片段、计时器和帧游标在系统中占用槽位
+    void activate();
+    /// @brief 把系统中的进度保存回组件并归还槽位
+    void deactivate();
+    /// @brief 非循环动画播放完毕（由 AnimationSystem 在 update 收尾时调用）
+    void on_animation_finished(const engine::render::AnimationSystem::State& state);
+
+    /// @brief 动画片段（通常只有几个，扁平数组中按 id 线性查找即可，不涉及字符串）
+    std::vector<Clip> animations_;
+    SpriteComponent* sprite_component_obs_ = nullptr;                   ///< @brief 指向必需的SpriteComponent的指针
+    engine::render::AnimationSystem* animation_system_obs_ = nullptr;   ///< @brief 推进动画的系统
+    const engine::render::Animation* current_animation_obs_ = nullptr;  ///< @brief 指向当前播放动画的原始指针
+
+    uint32_t state_index_ = INVALID_STATE;              ///< @brief 在 AnimationSystem 中的槽位（播放中有效，由系统在移动槽位时更新）
+    sf::Time animation_timer_ = sf::Time::Zero;         ///< @brief 停止时保存的计时器（播放中以系统中的状态为准）
+    uint32_t frame_cursor_ = 0;                         ///< @brief 停止时保存的帧下标（播放中以系统中的状态为准）
     bool is_one_shot_removal_ = false;                  ///< @brief 是否在动画结束后删除整个GameObject
 };
 } // namespace engine::component
\ No newline at end of file
@@ -1,7 +1,8 @@
 #pragma once
 #include "component.hpp"
+#include "resource_handle.hpp"
+#include "string_hash.hpp"
 #include <string>
-#include <unordered_map>
 
 namespace engine::audio {
     class AudioPlayer;
@@ -43,6 +44,13 @@ public:
      */
     void add_sound(std::string_view sound_id, std::string_view sound_path);
 
+    /**
+     * @brief 添加已解析的音效句柄（同一原型的对象共用一份句柄，无需逐个解析路径）。
+     * @param sound_id 音效的标识符。
+     * @param handle 音效资源句柄。
+     */
+    void add_sound(std::string_view sound_id, engine::resource::SoundHandle handle);
+
 private:
     // 核心循环方法
     void update(sf::Time, engine::core::Context&) override {}
@@ -51,6 +59,6 @@ private:
     engine::render::Camera* camera_obs_;                                ///< @brief 相机的非拥有指针，用于音频空间定位
     engine::component::TransformComponent* transform_obs_ = nullptr;    ///< @brief 缓存变换组件
 
-    std::unordered_map<std::string, std::string> sound_id_to_path_;     ///< @brief 音效id 到路径的映射表
+    engine::utils::StringMap<engine::resource::SoundHandle> sound_id_to_handle_;    ///< @brief 音效id 到资源句柄的映射表（添加时解析路径）
 };
 } // namespace engine::component
\ No newline at end of file
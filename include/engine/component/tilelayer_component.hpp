@@ -3,6 +3,9 @@
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace engine::core {
@@ -44,11 +47,32 @@ struct TileInfo {
     TileType type;              ///< @brief 瓦片的逻辑类型
 };
 
+/**
+ * @brief 无限地图区块中单个瓦片的紧凑数据（常驻内存；精灵只在区块载入烘焙时临时创建）
+ */
+struct ChunkTile {
+    const sf::Texture* texture = nullptr;   ///< @brief 纹理（空瓦片为 nullptr）
+    sf::IntRect rect;                       ///< @brief 源矩形，尺寸为 0 表示使用整张纹理
+    TileType type = TileType::Empty;        ///< @brief 瓦片的逻辑类型
+};
+
+/**
+ * @brief 无限地图瓦片层中的一个区块
+ */
+struct TileChunk {
+    sf::Vector2i position;                  ///< @brief 左上角瓦片坐标（必须是区块尺寸的整数倍）
+    std::vector<ChunkTile> tiles;           ///< @brief 按行主序存储的瓦片（区块尺寸 x * y 个）
+};
+
 /**
  * @brief 管理和渲染瓦片地图层。
  *
  * 存储瓦片地图的布局、每个瓦片的精灵信息和类型。
  * 负责在渲染阶段绘制可见的瓦片。
+ *
+ * 无限地图（区块模式）只常驻紧凑的瓦片数据，按区块坐标建立索引：碰撞查询直接查索引，
+ * 渲染前按相机流式范围（Camera::get_stream_bounds）载入区块并烘焙纹理，离开范围的区块卸载、纹理回收复用，
+ * 因此显存/内存占用只与视野大小有关，与关卡长度无关。
  */
 class TileLayerComponent final : public Component {
     friend class engine::object::GameObject;
@@ -65,19 +89,30 @@ public:
                      , sf::Vector2i map_size
                      , std::vector<TileInfo>&& tiles
     );
+    /**
+     * @brief 构造函数（无限地图，区块模式）
+     * @param tile_size 单个瓦片尺寸（像素）
+     * @param chunk_size 区块尺寸（瓦片数，所有区块相同）
+     * @param chunks 区块数据 (会被移动)
+     */
+    TileLayerComponent(engine::object::GameObject* owner
+                     , sf::Vector2i tile_size
+                     , sf::Vector2i chunk_size
+                     , std::vector<TileChunk>&& chunks
+    );
     ~TileLayerComponent();
 
     /**
      * @brief 根据瓦片坐标获取瓦片信息
      * @param pos 瓦片坐标 (0 <= x < map_size_.x, 0 <= y < map_size_.y)
-     * @return const TileInfo* 指向瓦片信息的指针，如果坐标无效则返回 nullptr
+     * @return const TileInfo* 指向瓦片信息的指针，如果坐标无效或处于区块模式（不保存精灵）则返回 nullptr
      */
     const TileInfo* get_tile_info_at(sf::Vector2i pos) const;
 
     /**
      * @brief 根据瓦片坐标获取瓦片类型
-     * @param pos 瓦片坐标 (0 <= x < map_size_.x, 0 <= y < map_size_.y)
-     * @return TileType 瓦片类型，如果坐标无效则返回 TileType::EMPTY
+     * @param pos 瓦片坐标（区块模式下可以为负）
+     * @return TileType 瓦片类型，如果坐标无效或不在任何区块内则返回 TileType::EMPTY
      */
     TileType get_tile_type_at(sf::Vector2i pos) const;
 
@@ -89,8 +124,11 @@ public:
     TileType get_tile_type_at_world_pos(const sf::Vector2f& world_pos) const;
 
     sf::Vector2i get_tile_size() const { return tile_size_; }                                                              ///< @brief 获取单个瓦片尺寸
-    sf::Vector2i get_map_size() const { return map_size_; }                                                                ///< @brief 获取地图尺寸
+    sf::Vector2i get_map_size() const { return map_size_; }                                                                ///< @brief 获取地图尺寸（区块模式为全部区块的包围范围）
     sf::Vector2f get_world_size() const { return sf::Vector2f(map_size_.x * tile_size_.x, map_size_.y * tile_size_.y); }   ///< @brief 获取地图世界尺寸
+    sf::FloatRect get_world_bounds() const;                                                                                ///< @brief 获取地图在世界中的范围（无限地图的原点可以为负）
+    bool is_chunked() const { return chunk_size_.x > 0; }                                                                  ///< @brief 是否为区块模式（无限地图）
+    size_t get_loaded_chunk_count() const { return loaded_chunks_.size(); }                                                ///< @brief 获取当前已载入（已烘焙）的区块数量
     const std::vector<TileInfo>& get_tiles() const { return tiles_; }                                                      ///< @brief 获取瓦片容器
     const sf::Vector2f& get_offset() const { return offset_; }                                                             ///< @brief 获取瓦片层的偏移量
     bool is_hidden() const { return is_hidden_; }                                                                          ///< @brief 获取是否隐藏（不渲染）
@@ -98,6 +136,12 @@ public:
     void set_offset(sf::Vector2f offset) { offset_ = std::move(offset); }                                                  ///< @brief 设置瓦片层的偏移量
     void set_hidden(bool hidden) { is_hidden_ = hidden; }                                                                  ///< @brief 设置是否隐藏（不渲染）
     void set_physics_engine(engine::physics::PhysicsEngine* physics_engine) {physics_engine_ = physics_engine; }           ///< @brief 设置物理引擎
+    void invalidate_cache() { cache_dirty_ = true; }                                                                       ///< @brief 标记缓存失效（纹理内容变化后调用），下次渲染时重建（区块模式下重新烘焙已载入的区块）
+
+    /**
+     * @brief 是否有瓦片使用指定纹理（用于纹理热重载后判断是否需要重建缓存）
+     */
+    bool uses_texture(const sf::Texture* texture) const;
 
 protected:
     // 核心循环方法
@@ -105,8 +149,20 @@ protected:
     void render(engine::core::Context& context) override;
 
 private:
+    /// @brief 已载入区块的渲染数据
+    struct LoadedChunk {
+        std::unique_ptr<sf::RenderTexture> texture;     ///< @brief 烘焙后的区块纹理
+        std::unique_ptr<sf::Sprite> sprite;             ///< @brief 绘制用精灵
+    };
+
     void rebuild_cache() const;
 
+    void build_chunk_index();                                               ///< @brief 建立区块索引并计算包围范围
+    void stream_chunks(const sf::FloatRect& stream_bounds);                 ///< @brief 载入流式范围内的区块，卸载范围外的区块
+    bool bake_chunk(uint32_t chunk, LoadedChunk& loaded) const;             ///< @brief 把区块的瓦片绘制到纹理中
+    const TileChunk* find_chunk(sf::Vector2i chunk_coord) const;            ///< @brief 根据区块坐标查找区块，不存在返回 nullptr
+    static uint64_t chunk_key(sf::Vector2i chunk_coord);                    ///< @brief 区块坐标 -> 索引键
+
     sf::Vector2i tile_size_;            ///< @brief 单个瓦片尺寸（像素）
     sf::Vector2i map_size_;             ///< @brief 地图尺寸（瓦片数）
     std::vector<TileInfo> tiles_;       ///< @brief 存储所有瓦片信息 (按"行主序"存储, index = y * map_width_ + x)
@@ -118,5 +174,13 @@ private:
     mutable sf::RenderTexture render_texture_;                              // mutable 因为 render() 是 const 上下文也能重建
     mutable bool cache_dirty_ = true;                                       // 是否需要重新绘制到 render_texture_
     mutable std::unique_ptr<sf::Sprite> cached_sprite_ = nullptr;           // 从 render_texture_ 生成的 sprite，每帧只 draw 这一个
+
+    // --- 区块模式 ---
+    sf::Vector2i chunk_size_ = {0, 0};                                      ///< @brief 区块尺寸（瓦片数），0 表示非区块模式
+    sf::Vector2i origin_ = {0, 0};                                          ///< @brief 包围范围左上角的瓦片坐标
+    std::vector<TileChunk> chunks_;                                         ///< @brief 全部区块的紧凑数据
+    std::unordered_map<uint64_t, uint32_t> chunk_index_;                    ///< @brief 区块坐标 -> chunks_ 下标
+    std::unordered_map<uint32_t, LoadedChunk> loaded_chunks_;               ///< @brief 已载入的区块（chunks_ 下标 -> 渲染数据）
+    std::vector<std::unique_ptr<sf::RenderTexture>> texture_pool_;          ///< @brief 卸载区块回收的纹理，载入新区块时复用
 };
 } // namespace engine::component
\ No newline at end of file
@@ -40,14 +40,24 @@ public:
 
     // 图形设置
     bool vsync_enabled_ = false;                    ///< @brief 垂直同步（默认关闭）
+    bool low_res_render_ = false;                   ///< @brief 低分辨率渲染：先绘制到逻辑分辨率的离屏纹理，再整数倍放大到窗口（默认关闭）
+    sf::Vector2u logical_size_ = {640u, 360u};      ///< @brief 低分辨率渲染时的逻辑分辨率（应与相机视口大小一致）
 
     // 性能设置
     unsigned int target_fps_ = 60;                  ///< @brief 目标FPS，0表示无限制
+    float texture_upload_budget_ms_ = 2.f;          ///< @brief 每帧用于上传异步加载纹理的时间预算（毫秒）
+    unsigned int resource_budget_mb_ = 0;           ///< @brief 纹理+音效的驻留内存预算（MB），0 表示不缓存、场景释放后立即卸载
+    std::string asset_archive_ = "assets.pak";      ///< @brief 资源包路径（由 asset_packer 生成），不存在时直接从散文件加载
+    float chunk_load_radius_ = 128.f;               ///< @brief 无限地图区块的流式加载半径（相机视野外扩的像素）
 
     // 音频设置
     float music_volume_ = 100.f;
     float sound_volume_ = 100.f;
 
+    // 开发设置
+    bool hot_reload_ = false;                       ///< @brief 监视 assets/ 并热重载变化的资源与配置（仅 Linux；开启时不挂载资源包）
+    bool hot_reload_level_ = true;                  ///< @brief 热重载时，地图/图块集变化后重新加载当前关卡并保留玩家位置
+
     // 存储动作名称到 sfml scancode/button 的名称列表映射
     using Scancode = sf::Keyboard::Scancode;
     using Button = sf::Mouse::Button;
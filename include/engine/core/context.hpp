@@ -22,8 +22,13 @@ namespace engine::audio {
     class AudioPlayer;
 } // namespace engine::audio
 
+namespace engine::scene {
+    class TilesetRegistry;
+} // namespace engine::scene
+
 namespace engine::core {
 class GameState;
+class ThreadPool;
 
 /**
  * @brief 持有对核心引擎模块引用的上下文对象
@@ -39,6 +44,10 @@ public:
      * @param camera 对 Camera 实例的引用。
      * @param resource_manager 对 ResourceManager 实例的引用。
      * @param physics_engine 对 PhysicsEngine 实例的引用。
+     * @param audio_player 对 AudioPlayer 实例的引用。
+     * @param game_state 对 GameState 实例的引用。
+     * @param thread_pool 对 ThreadPool 实例的引用。
+     * @param tileset_registry 对 TilesetRegistry 实例的引用。
      */
     Context(engine::input::InputManager& input_manager
           , engine::render::Renderer& renderer
@@ -46,7 +55,9 @@ public:
           , engine::resource::ResourceManager& resource_manager
           , engine::physics::PhysicsEngine& physics_engine
           , engine::audio::AudioPlayer& audio_player
-          , engine::core::GameState& game_state);
+          , engine::core::GameState& game_state
+          , engine::core::ThreadPool& thread_pool
+          , engine::scene::TilesetRegistry& tileset_registry);
     ~Context() = default;
 
     // 禁止拷贝和移动，Context 对象通常是唯一的或按需创建/传递
@@ -63,6 +74,8 @@ public:
     engine::physics::PhysicsEngine& get_physics_engine() const { return physics_engine_; }       ///< @brief 获取物理引擎
     engine::audio::AudioPlayer& get_audio_player() const { return audio_player_; }               ///< @brief 获取音频播放器
     engine::core::GameState& get_game_state() const { return game_state_; }                      ///< @brief 获取游戏状态
+    engine::core::ThreadPool& get_thread_pool() const { return thread_pool_; }                   ///< @brief 获取线程池
+    engine::scene::TilesetRegistry& get_tileset_registry() const { return tileset_registry_; }   ///< @brief 获取图块集缓存
 
 private:
     engine::input::InputManager& input_manager_;                ///< @brief 输入管理器
@@ -72,5 +85,7 @@ private:
     engine::physics::PhysicsEngine& physics_engine_;            ///< @brief 物理引擎
     engine::audio::AudioPlayer& audio_player_;                  ///< @brief 音频播放器
     engine::core::GameState& game_state_;                       ///< @brief 游戏状态
+    engine::core::ThreadPool& thread_pool_;                     ///< @brief 线程池
+    engine::scene::TilesetRegistry& tileset_registry_;          ///< @brief 图块集缓存
 };
 } // namespace engine::core
\ No newline at end of file
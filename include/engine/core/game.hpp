@@ -11,6 +11,7 @@ namespace sf {
 
 namespace engine::resource {
     class ResourceManager;
+    class AssetWatcher;
 } // namespace engine::resource
 
 namespace engine::render {
@@ -28,6 +29,7 @@ namespace engine::physics {
 
 namespace engine::scene {
     class SceneManager;
+    class TilesetRegistry;
 } // namespace engine::scene
 
 namespace engine::audio {
@@ -39,6 +41,7 @@ class Time;
 class Config;
 class Context;
 class GameState;
+class ThreadPool;
 /**
  * @brief 主游戏类，初始化资源，管理游戏循环
  */
@@ -68,6 +71,8 @@ private:
     void handle_event();
     void update(sf::Time delta);
     void render();
+    void handle_asset_changes();    ///< @brief 处理热重载：取走变化的资源文件并分发（未启用时直接返回）
+    void apply_config();            ///< @brief 将配置中可在运行时生效的部分应用到各组件
 
     // 配置组件，优先加载，优先级最高
     std::unique_ptr<engine::core::Config> config_;
@@ -80,6 +85,7 @@ private:
 
     // 引擎组件
     std::unique_ptr<engine::core::Time> time_;                                  ///< @brief 时间组件
+    std::unique_ptr<engine::core::ThreadPool> thread_pool_;                     ///< @brief 线程池组件（渲染、资源加载共用）
     std::unique_ptr<engine::resource::ResourceManager> resource_manager_;       ///< @brief 资源管理器组件
     std::unique_ptr<engine::input::InputManager> input_manager_;                ///< @brief 输入管理器组件
     std::unique_ptr<engine::render::Renderer> renderer_;                        ///< @brief 渲染器组件
@@ -87,7 +93,9 @@ private:
     std::unique_ptr<engine::physics::PhysicsEngine> physics_engine_;            ///< @brief 物理引擎组件
     std::unique_ptr<engine::audio::AudioPlayer> audio_player_;                  ///< @brief 音频播放组件
     std::unique_ptr<engine::core::GameState> game_state_;                       ///< @brief 游戏状态组件
+    std::unique_ptr<engine::scene::TilesetRegistry> tileset_registry_;          ///< @brief 图块集缓存（各关卡共用）
     std::unique_ptr<engine::core::Context> context_;                            ///< @brief ！上下文组件，最后初始化的组件
     std::unique_ptr<engine::scene::SceneManager> scene_manager_;                ///< @brief 场景管理器,依赖上下文，最后初始化
+    std::unique_ptr<engine::resource::AssetWatcher> asset_watcher_;             ///< @brief 资源目录监视器（仅在开启热重载时创建）
 };
 } // namespace engine::core
\ No newline at end of file
@@ -0,0 +1,77 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace engine::core {
+/**
+ * @brief 固定大小的工作线程池
+ *
+ * 供引擎各模块共享（渲染顶点生成、资源解码等），由 Game 持有并通过 Context 访问。
+ * 任务通过 submit() 投递并返回 std::future；parallel_for() 将区间切块，块由调用线程与工作线程通过原子计数器认领，
+ * 调用线程只执行本次调用的块，不会执行队列中其他模块的任务（例如资源解码）。
+ * 尚未被工作线程认领的块由调用线程自己完成，不依赖队列中任务的执行顺序，因此可以在工作线程中嵌套调用 parallel_for。
+ * parallel_for 的辅助任务放在单独的优先队列中，工作线程总是先取优先队列，
+ * 成批投递的资源解码不会让每帧的顶点生成、动画更新排在它们后面。
+ */
+class ThreadPool final {
+public:
+    /**
+     * @brief 构造函数
+     * @param thread_count 工作线程数量，0 表示使用硬件并发数 - 1（至少 1 个）
+     */
+    explicit ThreadPool(size_t thread_count = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    /**
+     * @brief 投递一个任务到线程池
+     * @param func 可调用对象
+     * @return 对应任务结果的 future
+     */
+    template<typename F>
+    auto submit(F&& func) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(func));
+        auto future = task->get_future();
+        {
+            std::lock_guard lock(mutex_);
+            tasks_.emplace([task]() { (*task)(); });
+        }
+        condition_.notify_one();
+        return future;
+    }
+
+    /**
+     * @brief 将 [0, count) 切分为若干块并行执行，阻塞直到全部完成
+     * @param count 元素总数
+     * @param min_chunk 每块的最少元素数（避免任务过碎）
+     * @param func 处理 [begin, end) 区间的函数
+     * @note 任一块抛出异常时，仍会等待其余块全部结束，再重新抛出第一个异常
+     */
+    void parallel_for(size_t count, size_t min_chunk, const std::function<void(size_t begin, size_t end)>& func);
+
+    size_t get_thread_count() const { return workers_.size(); }     ///< @brief 获取工作线程数量
+
+private:
+    void worker_loop();                                 ///< @brief 工作线程主循环
+
+    std::vector<std::jthread> workers_;                 ///< @brief 工作线程
+    std::queue<std::function<void()>> tasks_;           ///< @brief 待执行任务队列（submit）
+    std::queue<std::function<void()>> urgent_tasks_;    ///< @brief parallel_for 的辅助任务，优先于 tasks_ 执行
+    std::mutex mutex_;                                  ///< @brief 保护两个任务队列
+    std::condition_variable condition_;                 ///< @brief 任务到达/停止通知
+    bool stopping_ = false;                             ///< @brief 是否正在停止
+};
+} // namespace engine::core
@@ -0,0 +1,127 @@
+#pragma once
+#include "component.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace engine::object {
+using ComponentTypeId = uint32_t;
+
+namespace detail {
+ComponentTypeId next_component_type_id();       ///< @brief 分配下一个组件类型 id（线程安全）
+} // namespace detail
+
+/**
+ * @brief 获取组件类型的稠密 id
+ *
+ * 每个组件类型在第一次使用时分配一个从 0 开始连续递增的 id，之后只是读取一个静态变量，
+ * GameObject 以它为下标直接访问组件，不再对 type_index 做哈希。
+ */
+template<typename T>
+ComponentTypeId get_component_type_id() {
+    static const ComponentTypeId id = detail::next_component_type_id();
+    return id;
+}
+
+/// @brief 组件池的类型擦除基类（ObjectArena 按组件类型 id 持有各类型的池）
+class ComponentPoolBase {
+public:
+    virtual ~ComponentPoolBase() = default;
+    virtual void destroy(engine::component::Component* component) = 0;     ///< @brief 析构组件并归还槽位
+};
+
+/// @brief 把组件归还到所属池的删除器
+struct ComponentDeleter {
+    ComponentPoolBase* pool = nullptr;
+    void operator()(engine::component::Component* component) const { if (component) pool->destroy(component); }
+};
+
+/// @brief GameObject 持有组件使用的智能指针
+using ComponentPtr = std::unique_ptr<engine::component::Component, ComponentDeleter>;
+
+/**
+ * @brief 单一组件类型的分块对象池
+ *
+ * 同一类型的组件（例如所有 TransformComponent）分配在同一组连续内存块中，而不是分散在堆上，
+ * 物理、动画等系统遍历注册的组件时访问的是相邻的内存。块一经分配不再移动，组件地址在其生命周期内保持不变，
+ * 因此组件之间的观察者指针（transform_obs_ 等）不受影响。空闲槽位通过空闲链表复用。
+ * 内存块来自所属 ObjectArena，池随 ObjectArena（通常是场景）一起整体释放。
+ * 关卡加载时会在工作线程中添加组件，分配与归还加锁。
+ * @tparam T 组件类型
+ */
+template<typename T>
+class ComponentPool final : public ComponentPoolBase {
+public:
+    /// @brief 每块容纳的组件数量：约 16KB 一块，且至少 4 个
+    static constexpr size_t BLOCK_CAPACITY = std::max<size_t>(4, 16384 / sizeof(T));
+
+    explicit ComponentPool(std::pmr::memory_resource* resource) : resource_{resource} {}
+
+    ~ComponentPool() override {
+        for (auto* block : blocks_) resource_->deallocate(block, sizeof(Slot) * BLOCK_CAPACITY, alignof(Slot));
+    }
+
+    ComponentPool(const ComponentPool&) = delete;
+    ComponentPool& operator=(const ComponentPool&) = delete;
+
+    /// @brief 在池中构造组件；构造函数抛出异常时归还槽位
+    template<typename... Args>
+    ComponentPtr create(Args&&... args) {
+        void* slot = allocate();
+        try {
+            T* component = ::new (slot) T(std::forward<Args>(args)...);
+            return ComponentPtr(component, ComponentDeleter{this});
+        } catch (...) {
+            release(slot);
+            throw;
+        }
+    }
+
+    void destroy(engine::component::Component* component) override {
+        auto* typed = static_cast<T*>(component);
+        typed->~T();
+        release(typed);
+    }
+
+    size_t get_live_count() const { return live_count_; }                          ///< @brief 存活的组件数量
+    size_t get_capacity() const { return blocks_.size() * BLOCK_CAPACITY; }         ///< @brief 已分配的槽位总数
+
+private:
+    /// @brief 未初始化的槽位，大小与对齐与 T 相同
+    struct alignas(T) Slot {
+        std::byte storage[sizeof(T)];
+    };
+
+    void* allocate() {
+        std::lock_guard lock(mutex_);
+        if (free_slots_.empty()) {
+            // 新块的槽位倒序压入，使分配从块首开始、按地址递增
+            auto* block = static_cast<Slot*>(resource_->allocate(sizeof(Slot) * BLOCK_CAPACITY, alignof(Slot)));
+            blocks_.push_back(block);
+            for (auto i = BLOCK_CAPACITY; i-- > 0;) free_slots_.push_back(&block[i]);
+        }
+        auto* slot = free_slots_.back();
+        free_slots_.pop_back();
+        ++live_count_;
+        return slot;
+    }
+
+    void release(void* slot) {
+        std::lock_guard lock(mutex_);
+        free_slots_.push_back(static_cast<Slot*>(slot));
+        --live_count_;
+    }
+
+    std::pmr::memory_resource* resource_ = nullptr;     ///< @brief 内存块来源
+    std::mutex mutex_;                                  ///< @brief 保护分配与归还
+    std::vector<Slot*> blocks_;                         ///< @brief 内存块（只增不减，地址稳定）
+    std::vector<Slot*> free_slots_;                     ///< @brief 空闲槽位
+    size_t live_count_ = 0;                             ///< @brief 存活的组件数量
+};
+} // namespace engine::object
@@ -1,27 +1,53 @@
 #pragma once
 #include "component.hpp"
+#include "object_arena.hpp"
+#include "game_object_handle.hpp"
 #include <spdlog/spdlog.h>
+#include <cstddef>
 #include <memory>
+#include <memory_resource>
 #include <string>
-#include <unordered_map>
-#include <typeindex>            // 用于索引类型
+#include <typeinfo>
+#include <vector>
 #include <utility>              // 用于完美转发
 
 namespace sf {
     class Time;
 } // namespace sf
 
+namespace engine::scene {
+    class Scene;
+} // namespace engine::scene
+
 namespace engine::object {
 /**
  * @brief 游戏对象类，负责管理游戏对象的组件
  * 
  * 该类管理游戏对象的组件，并提供添加、获取、检查和移除组件的功能
  * 他还提供更新和渲染游戏对象的方法
+ * 组件按添加顺序存放并按此顺序更新；另有一张以组件类型 id 为下标的查找表，获取/检查组件均为 O(1)。
+ * 组件本身分配在按类型划分的 ComponentPool 中，同类组件在内存中相邻。
+ * 对象本身、名称与组件列表同样从所属的 ObjectArena（通常是场景的内存池）分配，
+ * 用 create() 创建即可指定内存池；直接 new / std::make_unique 的对象使用默认内存池。
  */
 class GameObject final {
+    friend class engine::scene::Scene;      ///< @brief 由场景分配与回收句柄、维护名称/标签索引
 public:
-    GameObject(std::string_view name = "", std::string_view tag = "");  ///< @brief 构造函数，默认名称为空，标签为空
-    ~GameObject() = default;
+    /**
+     * @brief 构造函数，默认名称为空，标签为空
+     * @param arena 名称、组件等的内存来源；为空时使用 ObjectArena::get_default()
+     */
+    GameObject(std::string_view name = "", std::string_view tag = "", ObjectArena* arena = nullptr);
+    ~GameObject();
+
+    /// @brief 在指定内存池中创建游戏对象（对象本身也从该内存池分配）
+    static std::unique_ptr<GameObject> create(ObjectArena& arena, std::string_view name = "", std::string_view tag = "");
+
+    // 对象内存从 ObjectArena 分配：分配块前部记录所属内存池，delete 时据此归还
+    static void* operator new(std::size_t size);
+    static void* operator new(std::size_t size, ObjectArena& arena);
+    static void operator delete(void* ptr, std::size_t size);
+    static void operator delete(void* ptr, ObjectArena& arena);     ///< @brief 仅在构造函数抛出异常时调用
 
     // 禁止拷贝和移动，确保唯一性 (通常游戏对象不应随意拷贝)
     GameObject(const GameObject&) = delete;
@@ -30,11 +56,13 @@ public:
     GameObject& operator=(GameObject&&) = delete;
 
     // setters and getters
-    void set_name(std::string_view name) { name_ = name; }                    ///< @brief 设置名称
-    void set_tag(std::string_view tag) { tag_ = tag; }                        ///< @brief 设置标签
+    void set_name(std::string_view name);                                     ///< @brief 设置名称（已加入场景时同步更新场景的名称索引）
+    void set_tag(std::string_view tag);                                       ///< @brief 设置标签（已加入场景时同步更新场景的标签索引）
     void set_need_remove(bool need_remove) { need_remove_ = need_remove; }    ///< @brief 设置是否需要删除
     std::string_view get_name() const { return name_; }                       ///< @brief 获取名称
     std::string_view get_tag() const { return tag_; }                         ///< @brief 获取标签
+    ObjectArena& get_arena() const { return *arena_; }                        ///< @brief 获取所属内存池
+    GameObjectHandle get_handle() const { return handle_; }                   ///< @brief 获取句柄（加入场景后有效）
     bool is_need_remove() const { return need_remove_; }                      ///< @brief 获取是否需要删除
     
     // 关键循环函数
@@ -53,17 +81,18 @@ public:
     template <typename T, typename... Args>
     T* add_component(Args&&... args) {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承自 Component");
-        auto type_index = std::type_index(typeid(T));
-
         // 如果组件存在，直接返回组件指针
         if (has_component<T>()) {
             return get_component<T>();
         }
 
         // 如果不存在就创建组件 记得把this传入！
-        auto new_component = std::make_unique<T>(this, std::forward<Args>(args)...);
-        T* ptr = new_component.get();
-        components_[type_index] = std::move(new_component);
+        auto new_component = arena_->get_pool<T>().create(this, std::forward<Args>(args)...);
+        T* ptr = static_cast<T*>(new_component.get());
+        auto type_id = get_component_type_id<T>();
+        if (type_id >= lookup_.size()) lookup_.resize(type_id + 1, nullptr);
+        lookup_[type_id] = ptr;
+        components_.push_back(std::move(new_component));
         spdlog::debug("GameObject::add_component: {} added component {}", name_, typeid(T).name());
         return ptr;
     }
@@ -77,11 +106,8 @@ public:
     template <typename T>
     T* get_component() const {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承自 Component");
-        auto type_index = std::type_index(typeid(T));
-        if (auto it = components_.find(type_index); it != components_.end()) {
-            return static_cast<T*>(it->second.get());
-        }
-        return nullptr;
+        auto type_id = get_component_type_id<T>();
+        return type_id < lookup_.size() ? static_cast<T*>(lookup_[type_id]) : nullptr;
     }
     
     /**
@@ -93,7 +119,8 @@ public:
     template <typename T>
     bool has_component() const {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承自 Component");
-        return components_.contains(std::type_index(typeid(T)));
+        auto type_id = get_component_type_id<T>();
+        return type_id < lookup_.size() && lookup_[type_id];
     }
 
     /**
@@ -104,16 +131,21 @@ public:
     template<typename T>
     void remove_component() {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承自 Component");
-        auto type_index = std::type_index(typeid(T));
-        if (auto it = components_.find(type_index); it != components_.end()) {
-            components_.erase(it);
-        }
+        auto type_id = get_component_type_id<T>();
+        if (type_id >= lookup_.size() || !lookup_[type_id]) return;
+        auto* component = lookup_[type_id];
+        lookup_[type_id] = nullptr;
+        std::erase_if(components_, [component](const auto& p) { return p.get() == component; });
     }
 
 private:
-    std::string name_;          ///< @brief 名称
-    std::string tag_;           ///< @brief 标签
-    std::unordered_map<std::type_index, std::unique_ptr<engine::component::Component>> components_;     ///< @brief 组件列表
+    ObjectArena* arena_ = nullptr;  ///< @brief 所属内存池（须比对象活得久）
+    GameObjectHandle handle_;       ///< @brief 场景分配的句柄
+    engine::scene::Scene* scene_obs_ = nullptr;     ///< @brief 所在场景（未加入场景时为 nullptr）
+    std::pmr::string name_;     ///< @brief 名称
+    std::pmr::string tag_;      ///< @brief 标签
+    std::pmr::vector<engine::component::Component*> lookup_;                   ///< @brief 组件类型 id -> 组件（非拥有，不存在为 nullptr）
+    std::pmr::vector<ComponentPtr> components_;                                ///< @brief 组件列表（按添加顺序，也是更新顺序）
     bool need_remove_ = false;  ///< @brief 延迟删除的标识，将由场景类负责管理
 };
 } // namespace engine::object
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+
+namespace engine::object {
+/**
+ * @brief 游戏对象的代数句柄
+ *
+ * 由 Scene 在对象加入场景时分配：index 为场景句柄表中的槽位，generation 为该槽位的代数。
+ * 对象被移除后槽位的代数加一，旧句柄随之失效，通过 Scene::get_game_object() 访问时返回 nullptr，
+ * 而不会像裸指针那样指向已销毁（或被新对象复用）的内存。
+ */
+class GameObjectHandle final {
+public:
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    GameObjectHandle() = default;
+    GameObjectHandle(uint32_t index, uint32_t generation) : index_{index}, generation_{generation} {}
+
+    uint32_t get_index() const { return index_; }                       ///< @brief 获取槽位下标
+    uint32_t get_generation() const { return generation_; }             ///< @brief 获取代数
+    bool is_valid() const { return index_ != INVALID_INDEX; }           ///< @brief 是否曾被分配（不代表对象仍然存活）
+
+    bool operator==(const GameObjectHandle&) const = default;
+
+private:
+    uint32_t index_ = INVALID_INDEX;    ///< @brief 槽位下标
+    uint32_t generation_ = 0;           ///< @brief 槽位代数
+};
+} // namespace engine::object
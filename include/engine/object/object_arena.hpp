@@ -0,0 +1,80 @@
+#pragma once
+#include "component_pool.hpp"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine::object {
+/**
+ * @brief 游戏对象内存池（每个场景一个，由 Scene 持有）
+ *
+ * 场景中的 GameObject 本身、名称/标签字符串、组件列表以及各类型的 ComponentPool 内存块都从这里分配，
+ * 底层是线程安全的 std::pmr::synchronized_pool_resource（关卡加载在工作线程中创建对象）。
+ * 对象销毁时内存只是回到池中；场景销毁时整个池一次性归还给系统，并输出分配统计。
+ * 场景之外创建的对象使用进程级的默认池 get_default()。
+ */
+class ObjectArena final : public std::pmr::memory_resource {
+public:
+    /// @brief 分配统计
+    struct Stats {
+        size_t allocation_count = 0;    ///< @brief 累计分配次数
+        size_t allocated_bytes = 0;     ///< @brief 累计分配字节数
+        size_t bytes_in_use = 0;        ///< @brief 当前使用中的字节数
+        size_t peak_bytes = 0;          ///< @brief 使用中字节数的峰值
+        size_t reserved_bytes = 0;      ///< @brief 当前向系统申请的字节数（含池内空闲部分）
+    };
+
+    explicit ObjectArena(std::string_view name);
+    ~ObjectArena() override;
+
+    ObjectArena(const ObjectArena&) = delete;
+    ObjectArena& operator=(const ObjectArena&) = delete;
+
+    /// @brief 进程级默认池（未指定场景的 GameObject 使用）
+    static ObjectArena& get_default();
+
+    /// @brief 获取某一组件类型的池（首次使用时创建）
+    template<typename T>
+    ComponentPool<T>& get_pool() {
+        auto type_id = get_component_type_id<T>();
+        std::lock_guard lock(pools_mutex_);
+        if (type_id >= pools_.size()) pools_.resize(type_id + 1);
+        if (!pools_[type_id]) pools_[type_id] = std::make_unique<ComponentPool<T>>(this);
+        return static_cast<ComponentPool<T>&>(*pools_[type_id]);
+    }
+
+    Stats get_stats() const;                                    ///< @brief 获取分配统计
+    std::string_view get_name() const { return name_; }         ///< @brief 获取名称（通常为场景名）
+    void log_stats(std::string_view when) const;                ///< @brief 输出分配统计
+
+private:
+    /// @brief 统计向系统申请内存的上游资源
+    class Upstream final : public std::pmr::memory_resource {
+    public:
+        std::atomic<size_t> reserved_bytes{0};
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    std::string name_;                                          ///< @brief 名称
+    Upstream upstream_;                                         ///< @brief 上游资源（最后销毁）
+    std::pmr::synchronized_pool_resource pool_;                 ///< @brief 按尺寸分级的内存池
+    std::atomic<size_t> allocation_count_{0};
+    std::atomic<size_t> allocated_bytes_{0};
+    std::atomic<size_t> bytes_in_use_{0};
+    std::atomic<size_t> peak_bytes_{0};
+    std::mutex pools_mutex_;                                    ///< @brief 保护 pools_
+    std::vector<std::unique_ptr<ComponentPoolBase>> pools_;     ///< @brief 组件类型 id -> 组件池（最先销毁）
+};
+} // namespace engine::object
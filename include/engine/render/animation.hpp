@@ -1,6 +1,8 @@
 #pragma once
+#include "animation_id.hpp"
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/System/Time.hpp>
+#include <cstdint>
 #include <vector>
 #include <string>
 
@@ -19,6 +21,8 @@ struct AnimationFrame {
  * @brief 管理一系列动画帧。
  *
  * 存储动画的帧、总时长、名称和循环行为。
+ * 添加帧时同步维护各帧结束时刻的前缀和（整数微秒），按时间取帧为二分查找；
+ * 所有帧时长相同（最常见的情况）时退化为一次整数除法。
  */
 class Animation final {
 public:
@@ -51,21 +55,44 @@ public:
      */
     const AnimationFrame& get_frame(sf::Time time) const;
 
+    /**
+     * @brief 获取在给定时间点应该显示的帧下标（动画不能为空）。
+     * @param time 当前时间。循环动画取模，非循环动画超过总时长时停留在最后一帧。
+     */
+    size_t get_frame_index(sf::Time time) const;
+
+    /**
+     * @brief 从上一次的帧下标（游标）出发查找给定时间点的帧下标（动画不能为空）。
+     *
+     * 顺序播放时时间单调前进，通常仍停留在游标所在帧或只前进一两帧，因此均摊 O(1)；
+     * 循环回绕时从第一帧重新开始前进。
+     * @param cursor 上一次返回的帧下标（越界时视为 0）
+     * @param time 当前时间
+     */
+    size_t advance_frame_index(size_t cursor, sf::Time time) const;
+
     // --- Setters and Getters ---
     std::string_view get_name() const { return name_; }                        ///< @brief 获取动画名称
+    AnimationId get_id() const { return id_; }                                   ///< @brief 获取动画名称驻留后的 id
     const std::vector<AnimationFrame>& get_frames() const { return frames_; }    ///< @brief 获取动画帧列表
     size_t get_frame_count() const { return frames_.size(); }                    ///< @brief 获取帧数量
     sf::Time get_total_duration() const { return total_duration_; }              ///< @brief 获取动画的总持续时间（秒）
     bool is_looping() const { return loop_; }                                    ///< @brief 检查动画是否循环播放
     bool is_empty() const { return frames_.empty(); }                            ///< @brief 检查动画是否没有帧
 
-    void set_name(std::string_view name) { name_ = name; }                     ///< @brief 设置动画名称
+    void set_name(std::string_view name) { name_ = name; id_ = AnimationId::intern(name); }   ///< @brief 设置动画名称
     void set_looping(bool loop) { loop_ = loop; }                                ///< @brief 设置动画是否循环播放
 
 private:
     std::string name_;                          ///< @brief 动画的名称 (例如, "walk", "idle")。
+    AnimationId id_;                            ///< @brief 名称驻留后的 id（构造时确定，播放时按 id 查找）
     std::vector<AnimationFrame> frames_;        ///< @brief 动画帧列表
+    std::vector<std::int64_t> frame_ends_;      ///< @brief 各帧结束时刻（微秒，前缀和），frame_ends_[i] 为第 i 帧的结束时刻
+    std::int64_t uniform_duration_ = 0;         ///< @brief 所有帧时长相同时为该时长（微秒），否则为 0
     sf::Time total_duration_ = sf::Time::Zero;  ///< @brief 动画的总持续时间（秒）
     bool loop_ = true;                          ///< @brief 默认动画是循环的
+
+    /// @brief 将时间映射到 [0, 总时长) 内的微秒数（循环动画取模）；非循环动画已超过总时长时返回 -1
+    std::int64_t local_time(sf::Time time) const;
 };
 } // namespace engine::render
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+namespace engine::render {
+/**
+ * @brief 驻留（intern）后的动画名称
+ *
+ * 同一名称在整个进程内始终对应同一个整数 id，比较只需一次整数比较。
+ * intern() 需要加锁并哈希字符串，应在加载或初始化阶段调用一次并缓存结果
+ * （例如文件作用域常量），之后每帧播放动画时只使用 id，不再构造或哈希任何字符串。
+ */
+class AnimationId final {
+public:
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    AnimationId() = default;
+
+    /// @brief 驻留名称，返回其 id（线程安全）
+    static AnimationId intern(std::string_view name);
+
+    uint32_t get_index() const { return index_; }                       ///< @brief 获取 id 的整数值
+    bool is_valid() const { return index_ != INVALID_INDEX; }           ///< @brief 是否为有效 id
+    std::string_view get_name() const;                                  ///< @brief 获取驻留的名称（用于日志），无效 id 返回空
+
+    bool operator==(const AnimationId&) const = default;
+
+private:
+    explicit AnimationId(uint32_t index) : index_{index} {}
+
+    uint32_t index_ = INVALID_INDEX;    ///< @brief 名称表下标
+};
+} // namespace engine::render
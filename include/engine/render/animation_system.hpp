@@ -0,0 +1,71 @@
+#pragma once
+#include <SFML/System/Time.hpp>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace sf {
+    class Sprite;
+} // namespace sf
+
+namespace engine::core {
+    class Context;
+} // namespace engine::core
+
+namespace engine::component {
+    class AnimationComponent;
+} // namespace engine::component
+
+namespace engine::render {
+class Animation;
+
+/**
+ * @brief 批量推进动画的系统（每个场景一个，由 Scene 持有）
+ *
+ * 所有正在播放的 AnimationComponent 的播放状态集中存放在一个连续数组中，
+ * 每帧在一个紧凑循环里统一推进（数量很多时分块交给线程池并行），只有帧发生变化的精灵才会重设纹理矩形。
+ * 组件开始播放时占用一个槽位，停止、播完或销毁时归还（与末尾元素交换后弹出），
+ * 因此数组中只有活动的动画，暂停或静止的对象不产生任何开销。只在主线程调用除 update 内部以外的接口。
+ */
+class AnimationSystem final {
+public:
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    /// @brief 单个活动动画的播放状态
+    struct State {
+        const Animation* animation = nullptr;                       ///< @brief 正在播放的片段（非拥有）
+        sf::Sprite* sprite = nullptr;                               ///< @brief 目标精灵（非拥有）
+        engine::component::AnimationComponent* component = nullptr; ///< @brief 所属组件（用于归还槽位与回调）
+        sf::Time timer = sf::Time::Zero;                            ///< @brief 播放计时器
+        uint32_t frame = 0;                                         ///< @brief 当前显示的帧下标（帧游标）
+        bool finished = false;                                      ///< @brief 非循环动画本帧播放完毕（update 收尾时处理）
+    };
+
+    AnimationSystem() = default;
+    ~AnimationSystem() = default;
+
+    // 禁止拷贝和移动
+    AnimationSystem(const AnimationSystem&) = delete;
+    AnimationSystem& operator=(const AnimationSystem&) = delete;
+    AnimationSystem(AnimationSystem&&) = delete;
+    AnimationSystem& operator=(AnimationSystem&&) = delete;
+
+    /// @brief 占用一个槽位，返回其下标（组件保存该下标，槽位移动时由系统更新）
+    uint32_t activate(const State& state);
+    /// @brief 归还槽位：末尾元素移入该位置并通知其组件
+    void deactivate(uint32_t index);
+
+    State& get_state(uint32_t index) { return states_[index]; }                ///< @brief 获取槽位中的播放状态
+    const State& get_state(uint32_t index) const { return states_[index]; }    ///< @brief 获取槽位中的播放状态
+    size_t get_active_count() const { return states_.size(); }                  ///< @brief 获取正在播放的动画数量
+
+    /// @brief 核心循环：推进所有活动动画，写回变化的纹理矩形，并结束播放完毕的非循环动画
+    void update(sf::Time delta, engine::core::Context& context);
+
+private:
+    /// @brief 推进 [begin, end) 区间内的动画，返回其中本帧播放完毕的数量（可在工作线程中调用）
+    size_t advance(size_t begin, size_t end, sf::Time delta);
+
+    std::vector<State> states_;         ///< @brief 活动动画的播放状态（连续存放）
+};
+} // namespace engine::render
@@ -3,6 +3,7 @@
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Graphics/View.hpp>
 #include <SFML/Graphics/Rect.hpp>
+#include <algorithm>
 #include <optional>
 
 namespace sf {
@@ -41,6 +42,7 @@ public:
     void set_ui_view_center(sf::Vector2f center);                           ///< @brief 设置ui摄像机中心
     void set_limit_bounds(std::optional<sf::FloatRect> limit_bounds);       ///< @brief 设置限制相机的移动范围
     void set_target(engine::component::TransformComponent* target) { target_obs_ = target; }         ///< @brief 设置跟随目标变换组件
+    void set_stream_radius(float radius) { stream_radius_ = std::max(radius, 0.f); }                 ///< @brief 设置流式加载半径（世界视野向外扩展的像素）
 
     const sf::Vector2f get_world_view_center() const { return world_view_.getCenter(); }             ///< @brief 获取世界摄像机中心位置
     const sf::Vector2f get_ui_view_center() const { return ui_view_.getCenter(); }                   ///< @brief 获取ui摄像机中心位置
@@ -49,6 +51,8 @@ public:
     sf::Vector2f get_ui_view_size() const { return ui_view_.getSize(); }                             ///< @brief 获取ui视口大小
     std::optional<sf::FloatRect> get_limit_bounds() const { return limit_bounds_; }                  ///< @brief 获取限制相机的移动范围
     engine::component::TransformComponent* get_target() const { return target_obs_; }                ///< @brief 获取跟随目标变换组件
+    float get_stream_radius() const { return stream_radius_; }                                       ///< @brief 获取流式加载半径
+    sf::FloatRect get_stream_bounds() const;                                                         ///< @brief 获取流式加载范围（世界视野向四周扩展流式加载半径）
 
     // 新增：获取SFML视图（用于设置到渲染窗口）
     const sf::View& get_world_view() const { return world_view_; }
@@ -68,6 +72,7 @@ private:
     sf::View ui_view_;                                              ///< @brief ui（界面）摄像机
     std::optional<sf::FloatRect> limit_bounds_;                     ///< @brief 限制相机的移动范围，空值表示不限制
     float smooth_speed_ = 5.f;                                      ///< @brief 相机移动的平滑速度
+    float stream_radius_ = 128.f;                                   ///< @brief 流式加载半径（像素），无限地图的区块在此范围内保持载入
     engine::component::TransformComponent* target_obs_ = nullptr;   ///< @brief 跟随目标变换组件，空值表示不跟随
 };
 } // namespace engine::render
\ No newline at end of file
@@ -1,21 +1,35 @@
 #pragma once
 
+#include "sprite_batch.hpp"
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include <string>
 #include <optional>
+#include <memory>
+#include <vector>
 
 namespace sf {
     class RenderWindow;
+    class RenderTarget;
+    class RenderTexture;
     class Sprite;
     class Text;
+    class Texture;
+    class View;
 } // namespace sf
 
 namespace engine::resource {
     class ResourceManager;
 } // namespace engine::resource
 
+namespace engine::core {
+    class Config;
+    class ThreadPool;
+} // namespace engine::core
+
 namespace engine::render {
 class Camera;
 
@@ -25,6 +39,13 @@ class Camera;
  * 包装 sf::RenderWindow 并提供清除屏幕、绘制精灵和呈现最终图像的方法。
  * 在构造时初始化。依赖于一个有效的 sf::RenderWindow 和 ResourceManager。
  * 构造失败会抛出异常。
+ *
+ * 开启低分辨率渲染（Config::low_res_render_）时，世界与UI先绘制到逻辑分辨率的离屏纹理，
+ * display_frame() 再以整数倍缩放的单个纹理四边形呈现到窗口，减少片元填充量并保证像素完美。
+ *
+ * 精灵绘制不会立即提交，而是记录为 SpriteCommand 并按（纹理, 视图）合批；批次在纹理或视图变化、
+ * 绘制文字/矩形、或帧结束时刷新。刷新时顶点生成在线程池上并行完成，每个工作线程写入
+ * 顶点缓冲中互不重叠的区间，最后由主线程一次性提交一个三角形列表。
  */
 class Renderer final {
 public:
@@ -33,11 +54,17 @@ public:
      *
      * @param window 指向有效的 SDL_Renderer 的指针。不能为空。
      * @param resource_manager 指向有效的 ResourceManager 的指针。不能为空。
-     * @throws std::runtime_error 如果任一指针为 nullptr。
+     * @param config 配置，用于决定是否开启低分辨率渲染。为空则直接绘制到窗口。
+     * @param thread_pool 线程池，用于并行生成批次顶点。为空则在主线程生成。
+     * @throws std::runtime_error 如果 window 或 resource_manager 为 nullptr。
      */
-    Renderer(sf::RenderWindow* window, engine::resource::ResourceManager* resource_manager);
+    Renderer(sf::RenderWindow* window
+           , engine::resource::ResourceManager* resource_manager
+           , const engine::core::Config* config = nullptr
+           , engine::core::ThreadPool* thread_pool = nullptr
+    );
 
-    ~Renderer() = default;
+    ~Renderer();
 
     /**
      * @brief 清空当前帧
@@ -45,10 +72,12 @@ public:
     void clear_frame();
 
     /**
-     * @brief 显示当前绘制内容
+     * @brief 显示当前绘制内容（低分辨率模式下先将离屏纹理整数倍放大到窗口）
      */
     void display_frame();
 
+    bool is_low_res() const { return render_texture_ != nullptr; }             ///< @brief 是否处于低分辨率渲染模式
+
     /**
      * @brief 绘制一个精灵
      * @param sprite 包含纹理ID、源矩形和翻转状态的 Sprite 对象。
@@ -101,7 +130,19 @@ public:
     void draw_ui_filled_rect(const Camera& camera, const sf::FloatRect& rect, sf::Color color);
 
 private:
+    void present_low_res();                                                     ///< @brief 将离屏纹理以整数倍缩放绘制到窗口中央
+    void push_sprite(const sf::View& view, const sf::Sprite& sprite);           ///< @brief 记录精灵绘制，纹理或视图变化时先刷新当前批次
+    void flush_batch();                                                         ///< @brief 生成当前批次的顶点并提交绘制
+
     sf::RenderWindow* window_obs_ = nullptr;                                    ///< @brief 窗口的观察者指针，不负责管理生命周期，不要在该类里手动释放他
     engine::resource::ResourceManager* resourec_manager_obs_ = nullptr;         ///< @brief 资源管理器的观察者指针，不负责管理生命周期，不要在该类里手动释放他
+    std::unique_ptr<sf::RenderTexture> render_texture_;                         ///< @brief 低分辨率模式下的离屏渲染目标（为空表示直接绘制到窗口）
+    sf::RenderTarget* target_obs_ = nullptr;                                    ///< @brief 当前的绘制目标（窗口或离屏纹理）
+    engine::core::ThreadPool* thread_pool_obs_ = nullptr;                       ///< @brief 线程池的观察者指针，可为空
+
+    std::vector<SpriteCommand> commands_;                                       ///< @brief 当前批次的精灵命令（每帧复用容量）
+    std::vector<sf::Vertex> vertices_;                                          ///< @brief 当前批次的顶点缓冲（每帧复用容量）
+    const sf::Texture* batch_texture_obs_ = nullptr;                            ///< @brief 当前批次使用的纹理
+    const sf::View* batch_view_obs_ = nullptr;                                  ///< @brief 当前批次使用的视图
 };
 } // namespace engine::render
@@ -0,0 +1,40 @@
+#pragma once
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace engine::core {
+    class ThreadPool;
+} // namespace engine::core
+
+namespace engine::render {
+/**
+ * @brief 一次精灵绘制记录，保存生成四边形所需的全部数据（不引用 sf::Sprite 本身，调用方可立即复用精灵）
+ */
+struct SpriteCommand {
+    sf::Transform transform;            ///< @brief 精灵的完整变换
+    sf::IntRect texture_rect;           ///< @brief 纹理源矩形（宽高为负表示翻转）
+    sf::Color color;                    ///< @brief 顶点颜色
+};
+
+inline constexpr size_t SPRITE_BATCH_VERTICES_PER_SPRITE = 6;      ///< @brief 每个精灵两个三角形
+inline constexpr size_t SPRITE_BATCH_PARALLEL_THRESHOLD = 1024;    ///< @brief 批次精灵数达到此值才分发到线程池，过小时调度开销大于收益
+
+/**
+ * @brief 为一批精灵生成三角形列表顶点（Renderer 刷新批次时调用，batch_benchmark 工具也直接使用）
+ *
+ * 每个精灵只写入自己的 6 个顶点，批次达到 SPRITE_BATCH_PARALLEL_THRESHOLD 且提供了线程池时，
+ * 按互不重叠的区间分发到线程池并行生成，无需加锁。
+ * @param commands 精灵命令
+ * @param vertices 输出顶点缓冲，大小调整为 commands.size() * 6（复用已有容量）
+ * @param thread_pool 线程池，为空则在调用线程生成
+ */
+void build_sprite_vertices(std::span<const SpriteCommand> commands, std::vector<sf::Vertex>& vertices, engine::core::ThreadPool* thread_pool);
+
+/// @brief 为单个精灵写入 6 个顶点（两个三角形）
+void build_sprite_quad(const SpriteCommand& command, sf::Vertex* out);
+} // namespace engine::render
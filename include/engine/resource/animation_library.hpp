@@ -0,0 +1,50 @@
+#pragma once
+#include "string_hash.hpp"
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace engine::render {
+    class Animation;
+} // namespace engine::render
+
+namespace engine::resource {
+
+/**
+ * @brief 进程级的动画片段库
+ *
+ * 每个动画片段（帧序列）只存储一份，以来源键（例如 "assets/maps/actor.tsj#3"，即图块集中的瓦片）分组、
+ * 以动画名称区分。AnimationComponent 只持有指向库中片段的非拥有指针，同一原型的所有对象共用同一组帧数据。
+ * 片段一经登记即不可修改，且在库销毁前一直有效；来源内容变化（例如热重载修改了动画属性）时
+ * 登记的是新片段，仍在使用旧片段的对象不受影响。只在主线程访问。
+ */
+class AnimationLibrary final {
+public:
+    AnimationLibrary();
+    ~AnimationLibrary();
+
+    AnimationLibrary(const AnimationLibrary&) = delete;
+    AnimationLibrary& operator=(const AnimationLibrary&) = delete;
+
+    /**
+     * @brief 登记动画片段
+     * @param key 来源键
+     * @param clip 构建好的片段；同一来源下已有同名且内容相同的片段时被丢弃，返回已有片段
+     * @return 库中的只读片段，clip 为空时返回 nullptr
+     */
+    const engine::render::Animation* add(std::string_view key, std::unique_ptr<engine::render::Animation> clip);
+
+    /**
+     * @brief 查找片段
+     * @return 该来源下最近登记的同名片段，不存在返回 nullptr
+     */
+    const engine::render::Animation* find(std::string_view key, std::string_view name) const;
+
+    size_t size() const { return clip_count_; }         ///< @brief 已登记的片段数量
+
+private:
+    engine::utils::StringMap<std::vector<std::unique_ptr<const engine::render::Animation>>> clips_;    ///< @brief 来源键 -> 片段（按登记顺序）
+    size_t clip_count_ = 0;
+};
+
+} // namespace engine::resource
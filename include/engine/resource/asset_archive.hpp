@@ -0,0 +1,130 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "string_hash.hpp"
+
+namespace engine::resource {
+
+/**
+ * @brief 资源包文件格式（所有整数为小端序）
+ *
+ * [magic "SLPK"][version u32][entry_count u32]
+ * entry_count 个索引项：[path_len u16][path][compression u8][offset u64][stored_size u64][original_size u64]
+ * 之后是各资源的数据块，offset 为相对文件开头的偏移。
+ * path 为相对工作目录的通用格式路径（如 "assets/textures/Actors/frog.png"），与加载时使用的路径一致。
+ */
+namespace archive_format {
+constexpr std::array<char, 4> MAGIC = {'S', 'L', 'P', 'K'};
+constexpr uint32_t VERSION = 1;
+constexpr size_t HEADER_SIZE = 12;                              ///< @brief magic + version + entry_count
+constexpr size_t ENTRY_FIXED_SIZE = 2 + 1 + 8 * 3;              ///< @brief 索引项中除路径以外的字节数
+constexpr uint64_t MAX_ORIGINAL_SIZE = uint64_t{1} << 30;       ///< @brief 单个资源解压后的大小上限（1 GiB），超出视为索引损坏
+constexpr uint64_t LZ4_MAX_EXPANSION = 255;                     ///< @brief LZ4 块的最大膨胀倍数（每个输入字节最多产生 255 字节输出）
+
+/// @brief 数据块的压缩方式
+enum class Compression : uint8_t {
+    None = 0,       ///< @brief 原样存储（PNG、OGG 等已压缩格式）
+    LZ4 = 1         ///< @brief LZ4 块压缩
+};
+} // namespace archive_format
+
+/**
+ * @brief 从资源包中读取出的一段数据
+ *
+ * 未压缩的数据直接指向映射的文件内存（零拷贝），压缩数据解压到自有缓冲区。
+ * 指向资源包映射内存的视图在所属 AssetArchive 关闭前有效；map_file() 得到的数据自己持有映射。只可移动。
+ */
+class AssetData final {
+public:
+    AssetData() = default;
+    static AssetData view(std::span<const std::byte> bytes);        ///< @brief 引用外部内存（不拷贝）
+    static AssetData own(std::vector<std::byte> bytes);             ///< @brief 持有一段缓冲区
+
+    /**
+     * @brief 只读映射一个散文件（随 AssetData 析构解除映射）
+     * @return 文件不存在或映射失败返回 std::nullopt；空文件返回空数据
+     */
+    static std::optional<AssetData> map_file(const std::filesystem::path& path);
+
+    AssetData(AssetData&&) noexcept = default;
+    AssetData& operator=(AssetData&&) noexcept = default;
+    AssetData(const AssetData&) = delete;
+    AssetData& operator=(const AssetData&) = delete;
+
+    const std::byte* data() const { return bytes_.data(); }
+    size_t size() const { return bytes_.size(); }
+    bool empty() const { return bytes_.empty(); }
+    std::span<const std::byte> bytes() const { return bytes_; }
+    std::string_view text() const { return {reinterpret_cast<const char*>(bytes_.data()), bytes_.size()}; }  ///< @brief 以文本方式访问（JSON 等）
+
+private:
+    std::vector<std::byte> owned_;                      ///< @brief 自有缓冲区（解压结果或散文件内容）
+    std::shared_ptr<const void> mapping_;               ///< @brief map_file() 建立的映射（析构时解除）
+    std::span<const std::byte> bytes_;                  ///< @brief 实际数据（指向 owned_ 或映射内存）
+};
+
+/**
+ * @brief 只读资源包，通过一次内存映射访问全部资源
+ *
+ * open() 映射整个文件并解析索引，之后 load() 只做哈希查找与（可选的）LZ4 解压，不再有文件 I/O 系统调用。
+ * 打开后对象不再被修改，load() 可以在多个工作线程上并发调用。
+ */
+class AssetArchive final {
+public:
+    AssetArchive() = default;
+    ~AssetArchive();
+
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    /**
+     * @brief 映射资源包并解析索引
+     * @param path 资源包路径
+     * @return 成功返回 true；文件不存在或格式错误返回 false，对象保持关闭状态
+     */
+    bool open(const std::filesystem::path& path);
+    void close();                                                   ///< @brief 解除映射并清空索引
+
+    bool is_open() const { return mapped_ != nullptr; }
+    size_t get_entry_count() const { return entries_.size(); }
+    bool contains(std::string_view path) const;                     ///< @brief 资源包中是否有该路径
+    std::optional<uint64_t> find_size(std::string_view path) const; ///< @brief 资源的原始大小（不解压），不在包中返回 std::nullopt
+
+    /**
+     * @brief 读取一个资源
+     * @param path 资源路径（相对或绝对均可，内部会规范化）
+     * @return 资源数据；不在包中或解压失败返回 std::nullopt
+     */
+    std::optional<AssetData> load(std::string_view path) const;
+
+    /// @brief 将路径规范化为索引键：相对工作目录、去除 ./ 与 ../、使用 '/' 分隔
+    static std::string normalize_path(std::string_view path);
+
+private:
+    struct Entry {
+        archive_format::Compression compression = archive_format::Compression::None;
+        uint64_t offset = 0;
+        uint64_t stored_size = 0;
+        uint64_t original_size = 0;
+    };
+
+    bool parse_index();                                             ///< @brief 解析并校验索引
+    const Entry* find_entry(std::string_view path) const;
+
+    const std::byte* mapped_ = nullptr;                             ///< @brief 映射的文件内存
+    size_t mapped_size_ = 0;
+#ifdef _WIN32
+    void* mapping_handle_ = nullptr;                                ///< @brief 文件映射对象句柄
+#endif
+    engine::utils::StringMap<Entry> entries_;                       ///< @brief 路径 -> 索引项
+};
+
+} // namespace engine::resource
@@ -0,0 +1,52 @@
+#pragma once
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::resource {
+
+/**
+ * @brief 资源目录监视器（开发期热重载使用）
+ *
+ * Linux 下基于 inotify：后台线程阻塞在 poll() 上等待内核通知，不会每帧轮询磁盘。
+ * 文件写入完成（IN_CLOSE_WRITE）或被编辑器以“写临时文件再改名”的方式替换（IN_MOVED_TO）时记录其路径，
+ * 新建的子目录会自动加入监视。主线程每帧调用 consume_changes() 取走去重后的变更列表。
+ * 其它平台暂不支持，start() 返回 false。
+ */
+class AssetWatcher final {
+public:
+    AssetWatcher() = default;
+    ~AssetWatcher();
+
+    AssetWatcher(const AssetWatcher&) = delete;
+    AssetWatcher& operator=(const AssetWatcher&) = delete;
+
+    /**
+     * @brief 开始递归监视目录
+     * @param root 根目录（例如 "assets"），上报的路径以它开头并使用 '/' 分隔，与资源加载时使用的路径一致
+     * @return 成功返回 true
+     */
+    bool start(const std::filesystem::path& root);
+    void stop();                                        ///< @brief 停止监视并等待后台线程退出
+    bool is_running() const { return thread_.joinable(); }
+
+    /// @brief 取走自上次调用以来发生变化的文件路径（已去重，主线程调用）
+    std::vector<std::string> consume_changes();
+
+private:
+    void watch_loop();                                  ///< @brief 后台线程：等待并解析 inotify 事件
+    void add_watch_recursive(const std::filesystem::path& dir);
+
+    int inotify_fd_ = -1;                               ///< @brief inotify 实例
+    int wake_fd_ = -1;                                  ///< @brief 用于唤醒后台线程退出的 eventfd
+    std::unordered_map<int, std::string> watch_dirs_;   ///< @brief 监视描述符 -> 目录路径（启动后只在后台线程访问）
+
+    std::mutex mutex_;                                  ///< @brief 保护 changes_
+    std::vector<std::string> changes_;                  ///< @brief 尚未被取走的变更路径
+    std::thread thread_;                                ///< @brief 后台监视线程
+};
+
+} // namespace engine::resource
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+
+namespace sf {
+    class Texture;
+    class SoundBuffer;
+    class Music;
+    class Font;
+} // namespace sf
+
+namespace engine::resource {
+/**
+ * @brief 类型安全的资源句柄
+ *
+ * 由 ResourceManager::get_*_handle() 在加载阶段根据路径解析一次，之后通过句柄访问资源只需一次数组下标。
+ * 同一路径始终对应同一个句柄：资源被卸载后句柄仍然有效，再次访问时会按原路径重新加载。
+ * @tparam T 资源类型，仅用于区分不同种类的句柄，防止混用
+ */
+template<typename T>
+class ResourceHandle final {
+public:
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    ResourceHandle() = default;
+    explicit ResourceHandle(uint32_t index) : index_{index} {}
+
+    uint32_t get_index() const { return index_; }                       ///< @brief 获取资源槽下标
+    bool is_valid() const { return index_ != INVALID_INDEX; }           ///< @brief 是否为有效句柄
+
+    bool operator==(const ResourceHandle&) const = default;
+
+private:
+    uint32_t index_ = INVALID_INDEX;    ///< @brief 资源槽下标
+};
+
+using TextureHandle = ResourceHandle<sf::Texture>;
+using SoundHandle = ResourceHandle<sf::SoundBuffer>;
+using MusicHandle = ResourceHandle<sf::Music>;
+using FontHandle = ResourceHandle<sf::Font>;
+} // namespace engine::resource
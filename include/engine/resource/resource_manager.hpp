@@ -2,53 +2,301 @@
 
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
-#include <unordered_map>
+#include "asset_archive.hpp"
+#include "animation_library.hpp"
+#include "resource_handle.hpp"
+#include "resource_manifest.hpp"
+#include "string_hash.hpp"
+#include <filesystem>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <future>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace engine::core {
+    class ThreadPool;
+} // namespace engine::core
 
 namespace engine::resource {
 
+/// @brief 资源种类，用于驻留统计与作用域记录
+enum class ResourceType {
+    Texture,
+    Sound,
+    Music,
+    Font
+};
+
+/**
+ * @brief 进行中的非阻塞预加载（由 ResourceManager::begin_preload() 创建，poll_preload() 推进）
+ */
+struct PreloadBatch {
+    std::vector<std::shared_future<sf::Texture*>> textures;
+    std::vector<std::shared_future<sf::SoundBuffer*>> sounds;
+    std::vector<std::shared_future<sf::Font*>> fonts;
+    size_t total = 0;               ///< @brief 资源总数（含音乐）
+    size_t loaded = 0;              ///< @brief 已完成数（含失败的）
+    size_t failed = 0;              ///< @brief 加载失败数
+    size_t music_failed = 0;        ///< @brief 音乐（开始时同步打开）的失败数
+
+    bool is_done() const { return loaded == total; }    ///< @brief 是否全部完成
+};
+
+/**
+ * @brief 管理纹理、音效、音乐与字体资源
+ *
+ * load_*_async() 在线程池上完成文件读取与解码（图像、音频、字体），返回 std::shared_future。
+ * 解码结果由主线程在 process_pending_loads() 中收尾：纹理在每帧时间预算内上传到显存，
+ * 其余资源直接登记。同步接口 load_*() 建立在异步接口之上，会阻塞等待并立即收尾对应资源。
+ * 音乐本身由 SFML 在独立线程流式解码，打开文件开销很小，因此 load_music_async() 在主线程打开并返回已就绪的 future。
+ * 资源表只在主线程读写，工作线程只接触自己解码的对象，因此无需加锁。
+ *
+ * 每种资源保存在按下标访问的槽数组中，路径到槽下标的映射使用透明哈希，字符串查找不会分配内存。
+ * 运行时频繁访问的资源应在加载阶段通过 get_*_handle() 解析为句柄，之后用句柄 O(1) 访问。
+ *
+ * 驻留管理：每个场景拥有一个驻留作用域，作用域活跃期间访问的纹理、音效、字体都会计入该作用域的引用。
+ * 作用域释放时引用计数归零的资源被卸载；若设置了内存预算，则改为保留为可淘汰缓存，
+ * 超出预算时按最近最少使用（LRU）顺序淘汰。仍被引用的资源永远不会被淘汰。
+ * 音乐是流式播放，不计入驻留管理。
+ *
+ * 资源包：mount_archive() 挂载打包后的资源文件后，所有加载先在包中查找（loadFromMemory / openFromMemory），
+ * 找不到再回退到散文件，因此开发期无需重新打包。
+ */
 class ResourceManager final {
 public:
-    ResourceManager() = default;
-    ~ResourceManager() = default;
+    /**
+     * @brief 构造函数
+     * @param thread_pool 用于后台解码的线程池，为空则在调用线程同步解码
+     */
+    explicit ResourceManager(engine::core::ThreadPool* thread_pool = nullptr);
+    ~ResourceManager();
 
     ResourceManager(const ResourceManager&) = delete;
     ResourceManager& operator=(const ResourceManager&) = delete;
 
+    // --- Archive ---
+    /**
+     * @brief 挂载资源包（应在发起任何加载之前调用）
+     * @return 成功返回 true；失败时继续只使用散文件
+     */
+    bool mount_archive(const std::filesystem::path& path);
+    const AssetArchive& get_archive() const { return archive_; }   ///< @brief 获取已挂载的资源包
+
+    /**
+     * @brief 读取任意资源文件的原始数据（地图、图块集等），先查资源包再回退到散文件
+     * @return 文件数据，两处都找不到返回 std::nullopt
+     */
+    std::optional<AssetData> read_asset(std::string_view file) const;
+
     // --- Texture ---
     sf::Texture* load_texture(std::string_view file);
+    std::shared_future<sf::Texture*> load_texture_async(std::string_view file);
     sf::Texture* get_texture(std::string_view file);
+    sf::Texture* get_texture(TextureHandle handle);
+    TextureHandle get_texture_handle(std::string_view file);    ///< @brief 解析路径对应的句柄（只分配槽，不触发加载）
+    sf::Texture* find_texture(std::string_view file) const;    ///< @brief 查找已加载的纹理，未加载返回 nullptr（不触发加载，不记录访问）
     void unload_texture(std::string_view file);
     void clear_textures();
 
     // --- SoundBuffer ---
     sf::SoundBuffer* load_sound(std::string_view file);
+    std::shared_future<sf::SoundBuffer*> load_sound_async(std::string_view file);
     sf::SoundBuffer* get_sound(std::string_view file);
+    sf::SoundBuffer* get_sound(SoundHandle handle);
+    SoundHandle get_sound_handle(std::string_view file);        ///< @brief 解析路径对应的句柄（只分配槽，不触发加载）
     void unload_sound(std::string_view file);
     void clear_sounds();
 
     // --- Music ---
     sf::Music* load_music(std::string_view file);
+    std::shared_future<sf::Music*> load_music_async(std::string_view file);
     sf::Music* get_music(std::string_view file);
+    sf::Music* get_music(MusicHandle handle);
+    MusicHandle get_music_handle(std::string_view file);        ///< @brief 解析路径对应的句柄（只分配槽，不触发加载）
     void unload_music(std::string_view file);
     void clear_musics();
 
     // --- Font ---
     sf::Font* load_font(std::string_view file);
+    std::shared_future<sf::Font*> load_font_async(std::string_view file);
     sf::Font* get_font(std::string_view file);
+    sf::Font* get_font(FontHandle handle);
+    FontHandle get_font_handle(std::string_view file);          ///< @brief 解析路径对应的句柄（只分配槽，不触发加载）
     void unload_font(std::string_view file);
     void clear_fonts();
 
+    // --- Async ---
+    /**
+     * @brief 收尾已解码完成的异步资源（必须在主线程每帧调用）
+     * @param texture_upload_budget 本帧纹理上传的时间预算，至少上传一张已就绪的纹理以保证进度
+     */
+    void process_pending_loads(sf::Time texture_upload_budget);
+    size_t get_pending_count() const;               ///< @brief 尚未收尾的异步加载数量
+
+    /**
+     * @brief 加载阶段：一次性载入清单中的全部资源，阻塞直到完成
+     *
+     * 并行模式下所有纹理、音效、字体同时投递到线程池解码，主线程在等待期间不断收尾已就绪的资源；
+     * 串行模式（或没有线程池）逐个同步加载。资源载入所属的仍是当前记录作用域。
+     * @param manifest 资源清单
+     * @param on_progress 进度回调 (已完成数, 总数)，开始时与每完成一批资源时在主线程调用，可用于绘制加载界面
+     * @param parallel 是否并行解码
+     * @return 全部加载成功返回 true
+     */
+    bool preload(const ResourceManifest& manifest
+               , const std::function<void(size_t loaded, size_t total)>& on_progress = {}
+               , bool parallel = true);
+
+    /**
+     * @brief 非阻塞的加载阶段：把清单中的纹理、音效、字体全部投递到线程池（音乐直接打开），立即返回
+     *
+     * 之后每帧调用 poll_preload() 推进，直到 PreloadBatch::is_done()。资源载入所属的仍是调用时的记录作用域。
+     */
+    PreloadBatch begin_preload(const ResourceManifest& manifest);
+
+    /**
+     * @brief 收尾已解码完成的资源并更新预加载进度（主线程调用）
+     * @param texture_upload_budget 本次纹理上传的时间预算
+     */
+    void poll_preload(PreloadBatch& batch, sf::Time texture_upload_budget);
+
+    // --- Hot reload ---
+    /**
+     * @brief 从磁盘重新加载一个已加载的纹理或音效，原对象原地更新
+     *
+     * 纹理与音效对象的地址保持不变，引用它们的 sf::Sprite / sf::Sound 无需重新设置。
+     * @return 该路径对应已加载的资源且重新加载成功返回 true
+     */
+    bool reload(std::string_view file);
+
+    // --- Residency ---
+    /**
+     * @brief 创建一个新的驻留作用域（不改变当前记录作用域，需要时再 set_active_residency_scope()）
+     * @return 作用域 id（非 0）
+     */
+    uint32_t begin_residency_scope();
+    void set_active_residency_scope(uint32_t scope_id) { active_scope_ = scope_id; }    ///< @brief 设置当前记录作用域，0 表示不记录
+    uint32_t get_active_residency_scope() const { return active_scope_; }              ///< @brief 获取当前记录作用域
+
+    /**
+     * @brief 释放驻留作用域，归还其对资源的引用
+     *
+     * 无内存预算时，引用计数归零的资源立即卸载；有预算时保留为缓存，超出预算再按 LRU 淘汰。
+     */
+    void release_residency_scope(uint32_t scope_id);
+
+    void set_memory_budget(size_t bytes);                           ///< @brief 设置纹理+音效的内存预算（字节），0 表示不限制
+    size_t get_memory_budget() const { return memory_budget_; }     ///< @brief 获取内存预算
+    size_t get_resident_bytes(ResourceType type) const;             ///< @brief 获取某类资源当前驻留的字节数（估算）
+
+    // --- Animation ---
+    AnimationLibrary& get_animation_library() { return animation_library_; }   ///< @brief 获取动画片段库（不随 clear_all() 清空，片段在管理器销毁前一直有效）
+
     // --- All ---
     void clear_all();
 
 private:
-    std::unordered_map<std::string, std::unique_ptr<sf::Texture>> textures_;
-    std::unordered_map<std::string, std::unique_ptr<sf::SoundBuffer>> sounds_;
-    std::unordered_map<std::string, std::unique_ptr<sf::Music>> musics_;
-    std::unordered_map<std::string, std::unique_ptr<sf::Font>> fonts_;
+    /**
+     * @brief 某一类资源的存储：槽数组 + 路径索引
+     *
+     * 槽一经分配便不再移除（卸载只释放资源本身），保证句柄下标始终有效。
+     */
+    template<typename T>
+    struct Storage {
+        struct Slot {
+            explicit Slot(std::string slot_key) : key{std::move(slot_key)} {}
+
+            std::string key;                                ///< @brief 资源路径（卸载后用于按句柄重新加载）
+            std::unique_ptr<T> resource;                    ///< @brief 资源本身，未加载或已卸载时为空
+            size_t bytes = 0;                               ///< @brief 资源占用的字节数（估算）
+            uint32_t ref_count = 0;                         ///< @brief 引用该资源的作用域记录数
+            uint32_t recorded_scope = 0;                    ///< @brief 最近一次记录到的作用域，用于跳过重复记录
+            uint64_t last_used = 0;                         ///< @brief 最近访问时刻（LRU 淘汰依据）
+            AssetData memory;                               ///< @brief 以内存方式打开的资源（字体、音乐）所依赖的数据
+        };
+        explicit Storage(ResourceType storage_type) : type{storage_type} {}
+
+        ResourceType type;                                  ///< @brief 资源种类
+        std::vector<Slot> slots;                            ///< @brief 句柄下标 -> 槽
+        engine::utils::StringMap<uint32_t> indices;         ///< @brief 路径 -> 句柄下标
+        size_t resident_bytes = 0;                          ///< @brief 已加载资源的字节数总和
+    };
+
+    /// @brief 工作线程的解码产物
+    template<typename T>
+    struct DecodeResult {
+        std::unique_ptr<T> resource;                        ///< @brief 解码结果，失败为空
+        AssetData memory;                                   ///< @brief 需要与资源一同保留的数据（可为空）
+    };
+
+    /**
+     * @brief 一个尚未收尾的异步加载
+     * @tparam Decoded 工作线程产出的类型（纹理为 sf::Image，其余与 Resource 相同）
+     * @tparam Resource 最终登记到资源表中的类型
+     */
+    template<typename Decoded, typename Resource>
+    struct PendingLoad {
+        std::string key;                                    ///< @brief 资源路径
+        uint32_t scope_id = 0;                              ///< @brief 发起请求时的记录作用域
+        std::future<DecodeResult<Decoded>> decoded;         ///< @brief 工作线程的解码结果
+        std::promise<Resource*> promise;                    ///< @brief 收尾后兑现
+        std::shared_future<Resource*> result;               ///< @brief 返回给调用方的共享结果
+    };
+
+    using PendingTexture = PendingLoad<sf::Image, sf::Texture>;
+    using PendingSound = PendingLoad<sf::SoundBuffer, sf::SoundBuffer>;
+    using PendingFont = PendingLoad<sf::Font, sf::Font>;
+
+    void finalize_texture(PendingTexture& pending);         ///< @brief 上传纹理并登记（主线程）
+    void finalize_sound(PendingSound& pending);             ///< @brief 登记音效（主线程）
+    void finalize_font(PendingFont& pending);               ///< @brief 登记字体（主线程）
+
+    // --- 存储辅助（仅在 cpp 中实例化） ---
+    template<typename T>
+    T* find_resource(Storage<T>& storage, std::string_view key);                    ///< @brief 按路径查找已加载资源并记录访问，未加载返回 nullptr
+    template<typename T>
+    typename Storage<T>::Slot* find_slot(Storage<T>& storage, ResourceHandle<T> handle);   ///< @brief 按句柄获取槽，句柄无效返回 nullptr
+    template<typename T>
+    uint32_t acquire_slot(Storage<T>& storage, std::string_view key);               ///< @brief 获取或分配路径对应的槽
+    template<typename T>
+    T* store_resource(Storage<T>& storage, std::string_view key, std::unique_ptr<T> resource, size_t bytes, uint32_t scope_id, AssetData memory = {});
+    template<typename T>
+    void touch(Storage<T>& storage, uint32_t index, uint32_t scope_id);             ///< @brief 更新 LRU 时刻并记录到作用域
+    template<typename T>
+    void release_slot(Storage<T>& storage, uint32_t index);                         ///< @brief 卸载槽中的资源（保留槽）
+    template<typename T>
+    void release_reference(Storage<T>& storage, uint32_t index);                    ///< @brief 归还一次作用域引用
+    void wait_pending_decodes() const;                      ///< @brief 阻塞等待所有已提交的解码任务结束（不收尾）
+
+    template<typename Pending, typename T, typename Load>
+    std::shared_future<T*> request_async(std::string_view file, Storage<T>& storage, std::vector<Pending>& pending, Load load);
+
+    void enforce_memory_budget();                           ///< @brief 超出预算时按 LRU 淘汰未被引用的纹理和音效
+
+    engine::core::ThreadPool* thread_pool_obs_ = nullptr;  ///< @brief 线程池的观察者指针，可为空
+    AssetArchive archive_;                                  ///< @brief 资源包，挂载后只读，可被工作线程并发访问
+
+    Storage<sf::Texture> textures_{ResourceType::Texture};
+    Storage<sf::SoundBuffer> sounds_{ResourceType::Sound};
+    Storage<sf::Music> musics_{ResourceType::Music};
+    Storage<sf::Font> fonts_{ResourceType::Font};
+
+    std::vector<PendingTexture> pending_textures_;          ///< @brief 按提交顺序排队等待上传的纹理
+    std::vector<PendingSound> pending_sounds_;
+    std::vector<PendingFont> pending_fonts_;
+
+    std::unordered_map<uint32_t, std::vector<std::pair<ResourceType, uint32_t>>> scopes_;  ///< @brief 作用域 id -> 记录的（资源种类, 槽下标）
+    uint32_t next_scope_id_ = 1;                            ///< @brief 下一个作用域 id（0 保留为“不记录”）
+    uint32_t active_scope_ = 0;                             ///< @brief 当前记录作用域
+    uint64_t access_clock_ = 0;                             ///< @brief 访问计数器，作为 LRU 时钟
+    size_t memory_budget_ = 0;                              ///< @brief 纹理+音效内存预算，0 表示不限制
+
+    AnimationLibrary animation_library_;                    ///< @brief 共享的动画片段
 };
 
 } // namespace engine::resource
@@ -0,0 +1,37 @@
+#pragma once
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine::resource {
+
+/**
+ * @brief 一组需要预加载的资源路径清单
+ *
+ * 由 LevelLoader 根据地图与图块集生成，场景再补充自己在代码中引用的资源，
+ * 然后交给 ResourceManager::preload() / begin_preload() 在加载阶段载入。路径自动去重。
+ */
+struct ResourceManifest {
+    std::vector<std::string> textures;
+    std::vector<std::string> sounds;
+    std::vector<std::string> musics;
+    std::vector<std::string> fonts;
+
+    void add_texture(std::string_view path) { add_unique(textures, path); }
+    void add_sound(std::string_view path) { add_unique(sounds, path); }
+    void add_music(std::string_view path) { add_unique(musics, path); }
+    void add_font(std::string_view path) { add_unique(fonts, path); }
+
+    size_t size() const { return textures.size() + sounds.size() + musics.size() + fonts.size(); }    ///< @brief 资源总数
+    bool empty() const { return size() == 0; }
+
+private:
+    /// @brief 清单通常只有几十项，线性查重即可
+    static void add_unique(std::vector<std::string>& list, std::string_view path) {
+        if (path.empty() || std::ranges::find(list, path) != list.end()) return;
+        list.emplace_back(path);
+    }
+};
+
+} // namespace engine::resource
@@ -0,0 +1,142 @@
+#pragma once
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace engine::component {
+    enum class TileType;
+} // namespace engine::component
+
+namespace engine::scene {
+
+/**
+ * 关卡的中间表示：Tiled 地图（.tmj + .tsj）或编译后的二进制关卡（.slvl）都先解析成 LevelData，
+ * 再由 LevelLoader 统一创建游戏对象。其中不含任何 SFML 资源对象，纹理以纹理表下标引用。
+ */
+
+constexpr uint32_t DEFAULT_TEXTURE_INDEX = 0;   ///< @brief 纹理表的第 0 项固定为默认纹理（空瓦片与解析失败时使用）
+
+/// @brief 一个瓦片解析后的渲染与逻辑信息
+struct TileData {
+    uint32_t texture = DEFAULT_TEXTURE_INDEX;   ///< @brief 纹理表下标
+    sf::IntRect rect;                           ///< @brief 源矩形，尺寸为 0 表示使用整张纹理
+    engine::component::TileType type{};         ///< @brief 瓦片类型（值初始化为 Empty）
+};
+
+/// @brief 动画帧
+struct FrameData {
+    sf::IntRect rect;                           ///< @brief 源矩形
+    float duration = 0.1f;                      ///< @brief 持续时间（秒）
+};
+
+/// @brief 一段动画
+struct AnimationData {
+    std::string name;
+    std::vector<FrameData> frames;
+};
+
+/// @brief 音效表项（音效 id -> 文件路径）
+struct SoundData {
+    std::string id;
+    std::string path;
+};
+
+/// @brief 对象的碰撞盒来源
+enum class ColliderKind : uint8_t {
+    None,       ///< @brief 没有碰撞盒
+    Sprite,     ///< @brief 与图片源矩形同大（SOLID 瓦片）
+    Custom      ///< @brief 瓦片中自定义的碰撞盒（collider_rect，相对图片左上角）
+};
+
+/**
+ * @brief 图块对象的原型：同一 gid 的全部对象共用（图片、碰撞盒、标签、重力、生命值、动画与音效表）
+ *
+ * 每个 gid 只在解析时生成一次，对象只记录原型下标；加载时每个原型也只编译一次（动画片段、音效句柄），
+ * 实例化对象时直接复用，不再逐个对象重复构建。
+ */
+struct PrototypeData {
+    std::string source;                         ///< @brief 来源瓦片（"图块集路径#局部 id"），共享动画片段以此为键
+    TileData tile;                              ///< @brief 图块
+    ColliderKind collider = ColliderKind::None;
+    sf::FloatRect collider_rect;                ///< @brief 自定义碰撞盒（ColliderKind::Custom 时有效）
+    std::string tag;                            ///< @brief 标签，空表示未设置
+    std::optional<bool> gravity;                ///< @brief 是否受重力影响（未设置则不改动）
+    std::optional<int> health;                  ///< @brief 生命值（未设置则不添加生命组件）
+    std::vector<AnimationData> animations;
+    std::vector<SoundData> sounds;
+};
+
+/// @brief 对象层中的一个对象
+struct ObjectData {
+    enum class Kind : uint8_t {
+        Shape,  ///< @brief 自定义矩形（触发器、碰撞盒）
+        Tile    ///< @brief 图块对象
+    };
+
+    Kind kind = Kind::Tile;
+    std::string name;
+    sf::Vector2f position;                      ///< @brief 左上角位置
+    sf::Vector2f size;                          ///< @brief 在世界中的尺寸（Shape 即碰撞盒尺寸；Tile 用于与图片尺寸相除得到缩放）
+    float rotation = 0.f;                       ///< @brief 旋转角度（度）
+
+    // --- Shape ---
+    std::string tag;                            ///< @brief 标签，空表示未设置
+    bool trigger = true;                        ///< @brief 是否为触发器
+
+    // --- Tile ---
+    uint32_t prototype = 0;                     ///< @brief 原型表（LevelData::prototypes）下标
+};
+
+/// @brief 无限地图瓦片层中的一个区块（Tiled "chunks"）
+struct ChunkData {
+    sf::Vector2i position;                      ///< @brief 左上角瓦片坐标（可以为负）
+    sf::Vector2i size;                          ///< @brief 区块尺寸（瓦片数量）
+    std::vector<TileData> tiles;                ///< @brief 按行主序存储的瓦片（size.x * size.y 个）
+};
+
+/// @brief 一个图层
+struct LayerData {
+    enum class Type : uint8_t {
+        Image,
+        Tile,
+        Object
+    };
+
+    Type type = Type::Tile;
+    std::string name;
+
+    // --- Image ---
+    uint32_t texture = DEFAULT_TEXTURE_INDEX;   ///< @brief 图片纹理下标
+    sf::Vector2f offset;                        ///< @brief 图层偏移
+    sf::Vector2f scroll_factor = {1.f, 1.f};    ///< @brief 视差因子
+    sf::Vector2<bool> repeat = {false, false};  ///< @brief 是否在 x/y 方向重复
+
+    std::vector<TileData> tiles;                ///< @brief Tile: 按行主序存储的瓦片（map_size.x * map_size.y 个，无限地图为空）
+    std::vector<ChunkData> chunks;              ///< @brief Tile: 无限地图的区块（有限地图为空）
+    std::vector<ObjectData> objects;            ///< @brief Object: 对象列表
+};
+
+/// @brief 解析关卡时读取的源文件（地图或图块集）
+struct DependencyData {
+    std::string path;                           ///< @brief 文件路径（规范化后的 "assets/..." 形式）
+    uint64_t content_hash = 0;                  ///< @brief 解析时的文件内容哈希
+    uint64_t file_size = 0;                     ///< @brief 编译时的文件大小（字节）
+    int64_t file_time = 0;                      ///< @brief 编译时的修改时间（file_clock 计数，0 表示未记录）
+};
+
+/// @brief 一个完整的关卡
+struct LevelData {
+    sf::Vector2i map_size;                      ///< @brief 地图尺寸（瓦片数量，无限地图以区块范围为准）
+    bool infinite = false;                      ///< @brief 是否为无限地图（瓦片层按区块存储）
+    sf::Vector2i tile_size;                     ///< @brief 瓦片尺寸（像素）
+    std::string music;                          ///< @brief 地图 "music" 属性指定的背景音乐，空表示未指定
+    std::vector<DependencyData> dependencies;   ///< @brief 地图本身及其引用的图块集（编译关卡据此判断是否过期）
+    std::vector<std::string> textures;          ///< @brief 纹理表（路径），第 0 项为默认纹理
+    std::vector<PrototypeData> prototypes;      ///< @brief 图块对象原型表（每个用到的 gid 一项）
+    std::vector<LayerData> layers;              ///< @brief 按绘制顺序排列的可见图层
+};
+
+} // namespace engine::scene
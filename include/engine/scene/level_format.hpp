@@ -0,0 +1,38 @@
+#pragma once
+#include "level_data.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace engine::scene {
+
+/**
+ * @brief 编译后的二进制关卡格式（.slvl，所有数值为小端序）
+ *
+ * [magic "SLVL"][version u32][map_size i32*2][infinite u8][tile_size i32*2][music][dependencies][textures][prototypes][layers]
+ * 字符串为 [len u32][bytes]，数组为 [count u32][元素...]，依赖为 [path][content_hash u64][file_size u64][file_time i64]，瓦片记录为 [texture u32][rect i32*4][type u8]，
+ * 瓦片层为 [tiles][chunks]，区块为 [position i32*2][size i32*2][tiles]；图块对象只记录原型下标。
+ * 所有 gid、瓦片类型、碰撞盒、动画帧与音效表都已在编译时解析完毕，读取时只做顺序拷贝，不涉及任何 JSON。
+ * TileType 的取值或 LevelData 的字段发生变化时必须提升 VERSION，旧文件会被拒绝并回退到 .tmj。
+ * 依赖表记录编译时读取的地图与图块集的大小、修改时间与内容哈希，任一源文件被修改后 LevelLoader 同样拒绝该文件。
+ */
+namespace level_format {
+constexpr std::array<char, 4> MAGIC = {'S', 'L', 'V', 'L'};
+constexpr uint32_t VERSION = 6;
+constexpr std::string_view EXTENSION = ".slvl";
+
+/// @brief 将关卡序列化为二进制数据
+std::vector<std::byte> write_level(const LevelData& level);
+
+/**
+ * @brief 从二进制数据读取关卡（可直接传入映射的文件内存）
+ * @return 关卡数据；魔数、版本不符或数据截断时返回 std::nullopt
+ */
+std::optional<LevelData> read_level(std::span<const std::byte> bytes);
+} // namespace level_format
+
+} // namespace engine::scene
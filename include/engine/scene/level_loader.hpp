@@ -1,16 +1,24 @@
 #pragma once
 #include "context.hpp"
-#include <SFML/System/Vector2.hpp>
-#include <SFML/Graphics/Rect.hpp>
-#include <nlohmann/json.hpp>
-#include <map>
+#include "resource_manifest.hpp"
+#include "level_data.hpp"
+#include <SFML/Graphics/Sprite.hpp>
+#include <memory>
+#include <optional>
 #include <string>
+#include <vector>
+
+namespace sf {
+    class Texture;
+} // namespace sf
+
+namespace engine::object {
+    class GameObject;
+    class ObjectArena;
+} // namespace engine::object
 
 namespace engine::component {
-    class AnimationComponent;
-    class AudioComponent;
-    struct TileInfo;
-    enum class TileType;
+    struct TileChunk;
 } // namespace engine::component
 
 namespace engine::scene {
@@ -18,116 +26,96 @@ class Scene;
 
 class LevelLoader final {
 public:
+    /// @brief 最近一次 load_level() 各阶段的耗时
+    struct LoadStats {
+        size_t task_count = 0;          ///< @brief 准备任务数量
+        double setup_ms = 0.0;          ///< @brief 解析纹理表、编译预制体
+        double prepare_ms = 0.0;        ///< @brief 准备阶段（并行或串行）
+        double insert_ms = 0.0;         ///< @brief 串行插入场景
+    };
+
     explicit LevelLoader(engine::core::Context& context);
     ~LevelLoader();
 
     /**
      * @brief 加载关卡数据到指定的 Scene 对象中。
-     * @param map_path Tiled JSON 地图文件的路径。
+     * @param map_path Tiled JSON 地图文件的路径（若旁边有编译好的同名 .slvl 文件则直接读取它）。
      * @param scene 要加载数据的目标 Scene 对象。
      * @return bool 是否加载成功。
      */
     [[nodiscard]]bool load_level(std::string_view level_path, Scene& scene);
 
-private:
-    void load_image_layer(const nlohmann::json& layer_json, Scene& scene);  ///< @brief 加载图片层
-    void load_tile_layer(const nlohmann::json& layer_json, Scene& scene);   ///< @brief 加载瓦片图层
-    void load_object_layer(const nlohmann::json& layer_json, Scene& scene); ///< @brief 加载对象图层
-
     /**
-     * @brief 添加动画到指定的 AnimationComponent。
-     * @param anim_json 动画json数据（自定义）
-     * @param ac AnimationComponent 指针（动画添加到此组件）
-     * @param sprite_size 每一帧动画的尺寸
+     * @brief 收集关卡引用的全部资源（图片层、用到的瓦片图片、瓦片音效、地图 "music" 属性），不创建游戏对象。
+     *        解析结果会被缓存，随后对同一地图调用 load_level() 不会重复解析。
+     * @param level_path Tiled JSON 地图文件的路径。
+     * @param manifest 输出的资源清单（追加）。
+     * @return bool 地图是否解析成功。
      */
-    void add_animation(const nlohmann::json& anim_json, engine::component::AnimationComponent* ac, const sf::Vector2i& sprite_size);
+    [[nodiscard]]bool collect_manifest(std::string_view level_path, engine::resource::ResourceManifest& manifest);
 
-    /**
-     * @brief 添加音效到指定的 AudioComponent。
-     * @param sound_json 音效json数据（自定义）
-     * @param audio_component AudioComponent 指针（音效添加到此组件）
-     */
-    void add_sound(const nlohmann::json& sound_json, engine::component::AudioComponent* audio_component);
+    /// @brief 设置准备阶段是否分发到线程池（默认开启；关闭后在调用线程串行执行，用于基准对比与调试）
+    void set_parallel_prepare(bool enabled) { parallel_prepare_ = enabled; }
+    const LoadStats& get_last_stats() const { return last_stats_; }    ///< @brief 获取最近一次加载的各阶段耗时
 
+private:
     /**
-     * @brief 获取瓦片属性
-     * @tparam T 属性类型
-     * @param tile_json 瓦片json数据
-     * @param property_name 属性名称
-     * @return 属性值，如果属性不存在则返回 std::nullopt
+     * @brief 获取关卡数据：优先读取同名的编译关卡（.slvl，内存映射，不做任何 JSON 解析），
+     *        不存在、版本不符或比 .tmj 旧时回退到 LevelParser 解析 JSON。同一路径只读取一次。
+     * @return 关卡数据，失败返回 nullptr。
      */
-    template<typename T>
-    std::optional<T> get_tile_property(const nlohmann::json& tile_json, std::string_view property_name) {
-        if (!tile_json.contains("properties")) return std::nullopt;
-        const auto& properties = tile_json["properties"];
-        for (const auto& property : properties) {
-            if (property.contains("name") && property["name"] == std::string(property_name)) {
-                if (property.contains("value")) {
-                    return property["value"].get<T>();
-                }
-            }
-        }
-        return std::nullopt;
-    }
+    const LevelData* get_level_data(std::string_view level_path);
+    std::optional<LevelData> read_compiled_level(std::string_view level_path) const;   ///< @brief 读取编译后的二进制关卡
+    bool dependency_may_have_changed(const DependencyData& dependency) const;          ///< @brief 源文件的大小/修改时间与编译时不同（需要比较哈希）
 
-    /**
-     * @brief 获取瓦片碰撞器矩形
-     * @param tile_json 瓦片json数据
-     * @return 碰撞器矩形，如果碰撞器不存在则返回 std::nullopt
-     */
-    std::optional<sf::FloatRect> get_collider_rect(const nlohmann::json& tile_json);
+    struct PreparedLayer;   ///< @brief 并行准备阶段的产物（定义见 .cpp）
+    struct Prefab;          ///< @brief 由原型编译得到的预制体（定义见 .cpp）
 
-    /**
-     * @brief 根据瓦片json对象获取瓦片类型
-     * @param tile_json 瓦片json数据
-     * @return 瓦片类型
-     */
-    engine::component::TileType get_tile_type(const nlohmann::json& tile_json);
+    /// @brief 一个准备任务：图层中 [begin, end) 范围的瓦片、区块或对象
+    struct PrepareTask {
+        size_t layer;
+        size_t begin;
+        size_t end;
+    };
 
-    /**
-     * @brief 根据（单一图片）图块集中的id获取瓦片类型
-     * @param tileset_json 图块集json数据
-     * @param local_id 图块集中的id
-     * @return 瓦片类型
-     */
-    engine::component::TileType get_tile_type_by_id(const nlohmann::json& tileset_json, int local_id);
-    
-    /**
-     * @brief 根据全局 ID 获取瓦片信息。
-     * @param gid 全局 ID。
-     * @return engine::component::TileInfo 瓦片信息。
-     */
-    engine::component::TileInfo get_tile_info_by_gid(int gid);
+    static constexpr size_t TILE_BATCH_SIZE = 2048;     ///< @brief 每个任务处理的瓦片数
+    static constexpr size_t CHUNK_BATCH_SIZE = 8;       ///< @brief 每个任务处理的区块数
+    static constexpr size_t OBJECT_BATCH_SIZE = 8;      ///< @brief 每个任务处理的对象数
+
+    void resolve_textures(const LevelData& level);      ///< @brief 解析纹理表（未预加载的纹理先并行解码）
+    void compile_prefabs(const LevelData& level);       ///< @brief 把原型表编译为预制体（每个原型只构建一次动画、解析一次音效）
 
     /**
-     * @brief 根据全局 ID 获取瓦片json对象 (用于对象层获取瓦片信息)
-     * @param gid 全局 ID
-     * @return 瓦片json对象
+     * @brief 准备图层中 [begin, end) 范围的内容（在工作线程中执行，只读关卡数据与纹理表，结果写入各自的槽位）
      */
-    std::optional<nlohmann::json> get_tile_json_by_gid(int gid) const;
+    void prepare_layer(const LayerData& layer, size_t begin, size_t end, PreparedLayer& prepared) const;
 
     /**
-     * @brief 加载 Tiled tileset 文件 (.tsj)。
-     * @param tileset_path Tileset 文件路径。
-     * @param first_gid 此 tileset 的第一个全局 ID。
+     * @brief 创建对象并添加不涉及共享状态的组件（变换、精灵、碰撞盒、生命值），可在工作线程中执行；
+     *        图块对象从预制体克隆
      */
-    void load_tileset(std::string_view tileset_path, int first_gid);
+    std::unique_ptr<engine::object::GameObject> prepare_object(const ObjectData& object) const;
 
     /**
-     * @brief 解析图片路径，合并地图路径和相对路径。例如：
-     * 1. 文件路径："assets/maps/level1.tmj"
-     * 2. 相对路径："../textures/Layers/back.png"
-     * 3. 最终路径："assets/textures/Layers/back.png"
-     * @param relative_path 相对路径（相对于文件）
-     * @param file_path 文件路径
-     * @return std::string 解析后的完整路径。
+     * @brief 补全需要访问共享状态的组件（物理组件注册到物理引擎、动画组件关联场景的动画系统、音效解析句柄），在主线程按顺序执行
      */
-    std::string resolve_path(std::string_view relative_path, std::string_view file_path);
+    void finish_object(const ObjectData& object, engine::object::GameObject& game_object, Scene& scene) const;
+
+    void add_prepared_layer(const LayerData& layer, PreparedLayer& prepared, Scene& scene);        ///< @brief 把准备好的图层插入场景
+    void add_chunked_tile_layer(const LayerData& layer, PreparedLayer& prepared, Scene& scene);    ///< @brief 插入无限地图的瓦片图层（区块模式）
+
+    /// @brief 根据瓦片数据创建精灵（源矩形尺寸为 0 时使用整张纹理）
+    sf::Sprite make_sprite(const TileData& tile) const;
+    /// @brief 把区块转换为组件使用的紧凑数据
+    engine::component::TileChunk make_chunk(const ChunkData& chunk_data) const;
 
-    std::string map_path_;                          ///< @brief 地图路径（拼接路径时需要）
-    sf::Vector2i map_size_;                         ///< @brief 地图尺寸（瓦片数量）
-    sf::Vector2i tile_size_;                        ///< @brief 瓦片尺寸（像素）
-    std::map<int, nlohmann::json> tileset_data_;    ///< @brief firstgid -> 瓦片集数据
+    std::string level_path_;                        ///< @brief 已读取的关卡路径
+    std::optional<LevelData> level_data_;           ///< @brief 已读取的关卡数据（collect_manifest 与 load_level 共用）
+    std::vector<sf::Texture*> textures_;            ///< @brief 纹理表对应的纹理（load_level 期间有效）
+    std::vector<Prefab> prefabs_;                   ///< @brief 原型表对应的预制体（load_level 期间有效）
+    engine::object::ObjectArena* object_arena_obs_ = nullptr;  ///< @brief 目标场景的对象内存池（load_level 期间有效）
+    bool parallel_prepare_ = true;                  ///< @brief 准备阶段是否并行
+    LoadStats last_stats_;                          ///< @brief 最近一次加载的各阶段耗时
     engine::core::Context& context_;                ///< @brief 上下文引用，用于加载资源
 };
 } // namespace engine::scene
\ No newline at end of file
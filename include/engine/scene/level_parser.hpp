@@ -0,0 +1,109 @@
+#pragma once
+#include "level_data.hpp"
+#include "tileset.hpp"
+#include "tileset_registry.hpp"
+#include "asset_archive.hpp"
+#include "string_hash.hpp"
+#include <nlohmann/json.hpp>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace engine::scene {
+
+/**
+ * @brief 将 Tiled 地图（.tmj）及其引用的图块集（.tsj）解析为 LevelData
+ *
+ * 只做数据层面的工作（gid 解析、属性读取、路径拼接），不创建游戏对象也不加载纹理，
+ * 因此既用于运行时加载 JSON 关卡，也用于离线把关卡编译为二进制格式。
+ * 图块集加载时即预处理为 Tileset，并按 gid 展开成稠密表，解析每个瓦片只需一次下标访问。
+ */
+class LevelParser final {
+public:
+    /// @brief 读取文件的方式（运行时经由 ResourceManager 读取资源包，离线工具直接读散文件）
+    using FileReader = std::function<std::optional<engine::resource::AssetData>(std::string_view path)>;
+
+    static constexpr std::string_view DEFAULT_TEXTURE = "assets/textures/Props/big-crate.png";  ///< @brief 纹理表第 0 项
+
+    /**
+     * @param read_file 文件读取函数
+     * @param tilesets 图块集缓存（多个关卡共用同一批图块集时只解析一次）
+     */
+    LevelParser(FileReader read_file, TilesetRegistry& tilesets);
+
+    /**
+     * @brief 解析地图文件
+     * @param level_path Tiled JSON 地图文件的路径
+     * @return 解析结果，地图文件无法读取或格式错误返回 std::nullopt
+     */
+    std::optional<LevelData> parse(std::string_view level_path);
+
+private:
+    void parse_image_layer(const nlohmann::json& layer_json, LevelData& level);    ///< @brief 解析图片层
+    void parse_tile_layer(const nlohmann::json& layer_json, LevelData& level);     ///< @brief 解析瓦片图层
+    void parse_object_layer(const nlohmann::json& layer_json, LevelData& level);   ///< @brief 解析对象图层
+
+    /**
+     * @brief 获取瓦片层（或区块）的 gid 数组
+     * @param layer_json 图层 json（提供 "encoding"/"compression"）
+     * @param data_json 数据所在的 json（有限地图为图层本身，无限地图为区块）
+     * @param decoded base64 数据的解码缓冲区
+     * @return gid 数组（指向 SAX 缓冲区或 decoded），缺失或解码失败返回 std::nullopt
+     */
+    std::optional<std::span<const uint32_t>> get_tile_data(const nlohmann::json& layer_json
+                                                         , const nlohmann::json& data_json
+                                                         , std::vector<uint32_t>& decoded) const;
+
+    /**
+     * @brief 解码 base64（可选 zlib/gzip/zstd 压缩）编码的瓦片层数据
+     * @param gids 输出的 gid 缓冲区（大小为 data_json 中的宽 * 高）
+     * @return 成功返回 true
+     */
+    bool decode_tile_data(const nlohmann::json& layer_json, const nlohmann::json& data_json, std::vector<uint32_t>& gids) const;
+
+    /**
+     * @brief 根据全局 ID 解析瓦片（查表，O(1)），并把用到的纹理登记到关卡纹理表
+     * @return 瓦片数据；gid 为 0 或解析失败时返回使用默认纹理的空瓦片
+     */
+    TileData resolve_tile(int gid, LevelData& level);
+
+    /// @brief 根据全局 ID 获取瓦片定义，不存在返回 nullptr
+    const TileDefinition* find_tile(int gid) const;
+    /// @brief 根据全局 ID 获取瓦片来源（"图块集路径#局部 id"，与地图无关），不存在返回空字符串
+    std::string get_tile_source(int gid) const;
+
+    /**
+     * @brief 获取 gid 对应的对象原型（每个 gid 只生成一次）
+     * @return 原型表下标；瓦片的动画或音效属性有误时返回 std::nullopt（对象应被跳过）
+     */
+    std::optional<uint32_t> get_prototype(int gid, LevelData& level);
+
+    uint32_t intern_texture(std::string path, LevelData& level);      ///< @brief 登记纹理路径并返回纹理表下标
+    bool load_tileset(std::string_view tileset_path, int first_gid);   ///< @brief 从缓存获取图块集 (.tsj) 并填充 gid 表
+
+    /// @brief 地图引用的一个图块集
+    struct TilesetRef {
+        std::shared_ptr<const Tileset> tileset;     ///< @brief 共享的图块集（同时保证 gid 表中的指针有效）
+        std::vector<uint32_t> texture_indices;      ///< @brief 图块集纹理下标 -> 关卡纹理表下标（首次使用时登记）
+    };
+
+    /// @brief gid 表项：瓦片所属图块集与瓦片定义
+    struct GidEntry {
+        uint32_t tileset = 0;                       ///< @brief tilesets_ 下标
+        const TileDefinition* tile = nullptr;       ///< @brief 瓦片定义，nullptr 表示该 gid 无效
+    };
+
+    FileReader read_file_;                                  ///< @brief 文件读取函数
+    TilesetRegistry& tileset_registry_;                     ///< @brief 图块集缓存
+    std::string map_path_;                                  ///< @brief 地图路径（拼接路径时需要）
+    std::vector<TilesetRef> tilesets_;                      ///< @brief 地图引用的图块集
+    std::vector<GidEntry> gid_table_;                       ///< @brief gid -> 瓦片（稠密表，下标即 gid）
+    engine::utils::StringMap<uint32_t> texture_indices_;    ///< @brief 纹理路径 -> 纹理表下标
+    std::unordered_map<int, std::optional<uint32_t>> prototype_indices_;   ///< @brief gid -> 原型表下标（空表示该 gid 无法生成原型）
+    std::vector<std::vector<uint32_t>> tile_data_;          ///< @brief 流式解析得到的各瓦片层/区块 gid（解析期间有效）
+};
+
+} // namespace engine::scene
@@ -1,5 +1,10 @@
 #pragma once
 #include "ui_manager.hpp"
+#include "animation_system.hpp"
+#include "object_arena.hpp"
+#include "game_object.hpp"
+#include "game_object_handle.hpp"
+#include "string_hash.hpp"
 #include <vector>
 #include <memory>
 #include <string>
@@ -9,9 +14,10 @@ namespace engine::core {
     class Context;
 } // namespace engine::core
 
-namespace engine::object {
-    class GameObject;
-} // namespace engine::object
+namespace engine::resource {
+    struct ResourceManifest;
+    struct PreloadBatch;
+} // namespace engine::resource
 
 namespace engine::scene {
 class SceneManager;
@@ -20,6 +26,13 @@ class SceneManager;
  *
  * 包含一组游戏对象，并提供更新、渲染、处理输入和清理的接口。
  * 派生类应实现具体的场景逻辑。
+ * 构造函数只做轻量的成员初始化，创建游戏对象、加载资源放在 init() 中：
+ * SceneManager 将场景压入栈顶并激活它的驻留作用域后调用 enter()，场景使用的资源因此计入自己的作用域。
+ * enter() 开始加载阶段：collect_resources() 声明的资源在后台解码，期间由主循环每帧推进并在正常的渲染流程中绘制进度条，
+ * 全部完成后才调用 init()。
+ * 作用域在场景析构时释放（包括从未进入场景栈、被后续请求覆盖的场景），只被本场景使用的资源随之卸载。
+ * 场景中的游戏对象与组件从场景自己的 ObjectArena 分配，场景销毁时整体释放并输出分配统计。
+ * 场景按名称和标签维护对象索引，按名称/标签查找和遍历只访问匹配的对象。
  */
 class Scene {
 public:
@@ -33,53 +46,150 @@ public:
     Scene(std::string_view name, engine::core::Context& context, engine::scene::SceneManager& scene_manager);
 
     virtual ~Scene();           // 1. 基类必须声明虚析构函数才能让派生类析构函数被正确调用。
-                                // 2. 析构函数定义必须写在cpp中，不然需要引入GameObject头文件
+                                // 2. 析构函数定义写在cpp中，成员的析构代码只在场景的编译单元中生成
     // 禁止拷贝和移动构造
     Scene(const Scene&) = delete;
     Scene& operator=(const Scene&) = delete;
     Scene(Scene&&) = delete;
     Scene& operator=(Scene&&) = delete;
 
+    /**
+     * @brief 进入场景（场景进入栈顶并激活驻留作用域后由 SceneManager 调用一次）。
+     *        开始预加载 collect_resources() 声明的资源，没有要预加载的资源时直接调用 init()。
+     */
+    void enter();
+
+    /// @brief 初始化场景（创建游戏对象等）。加载阶段结束后调用一次，此时预加载的资源均已就绪。
+    virtual void init() {}
+
+    // 加载阶段（is_loading() 期间 SceneManager 调用以下方法代替 update() / render()，并且不处理输入）
+    bool is_loading() const { return loading_ != nullptr; }                 ///< @brief 是否处于加载阶段
+    void update_loading();                      ///< @brief 收尾已解码的资源，全部完成后调用 init()
+    void render_loading();                      ///< @brief 在屏幕中央绘制加载进度条
+
     // 核心循环方法
     virtual void update(sf::Time delta);        ///< @brief 更新场景。
     virtual void render();                      ///< @brief 渲染场景。
     virtual void handle_input();                ///< @brief 处理输入。
 
+    /**
+     * @brief 资源文件在磁盘上发生变化（热重载，由 SceneManager 转发给栈中所有场景）。
+     *        此时 ResourceManager 已原地重新加载了对应的纹理/音效；默认实现重建使用该纹理的瓦片层缓存。
+     * @param path 变化的文件路径（"assets/..."）
+     */
+    virtual void on_asset_changed(std::string_view path);
+
+    /// @brief 在场景的内存池中创建游戏对象（尚未加入场景，需要再调用 add_game_object / safe_add_game_object）
+    std::unique_ptr<engine::object::GameObject> create_game_object(std::string_view name = "", std::string_view tag = "");
+
     /// @brief 直接向场景中添加一个游戏对象。（初始化时可用，游戏进行中不安全） （&&表示右值引用，与std::move搭配使用，避免拷贝）
     virtual void add_game_object(std::unique_ptr<engine::object::GameObject>&& game_object);
 
     /// @brief 安全地添加游戏对象。（添加到pending_additions_中）
     virtual void safe_add_game_object(std::unique_ptr<engine::object::GameObject>&& game_object); 
 
-    /// @brief 直接从场景中移除一个游戏对象。（一般不使用，但保留实现的逻辑）
+    /**
+     * @brief 直接从场景中移除一个游戏对象。（一般不使用，但保留实现的逻辑）
+     * @note 通过句柄 O(1) 定位，但为保持渲染顺序需要前移其后的所有对象并更新它们的槽位，每次调用 O(n)。
+     *       游戏进行中或需要移除多个对象时请使用 safe_remove_game_object()，由下一帧的批量压缩一次完成，总计 O(n)。
+     */
     virtual void remove_game_object(engine::object::GameObject* game_object_ptr);
 
-    /// @brief 安全地移除游戏对象。（设置need_remove_标记）
+    /// @brief 安全地移除游戏对象。（设置need_remove_标记，下一帧开始时统一移除）
     virtual void safe_remove_game_object(engine::object::GameObject* game_object_ptr);
 
     /// @brief 获取场景中的游戏对象容器。
     const std::vector<std::unique_ptr<engine::object::GameObject>>& get_game_objects() const;
 
-    /// @brief 根据名称查找游戏对象（返回找到的第一个对象）。
+    /// @brief 根据句柄获取游戏对象，对象已被移除（句柄过期）或句柄无效时返回 nullptr。
+    engine::object::GameObject* get_game_object(engine::object::GameObjectHandle handle) const;
+
+    /// @brief 根据名称查找游戏对象（返回最早加入场景的同名对象），通过名称索引 O(1) 查找。
     engine::object::GameObject* find_game_object_by_name(std::string_view name) const;
 
+    /**
+     * @brief 对场景中所有该名称的游戏对象调用 func（略过已标记移除的对象），只访问名称匹配的对象。
+     * @note 回调中可以添加对象；移除对象请使用 safe_remove_game_object()，不要在回调中修改对象的名称/标签。
+     */
+    template<typename F>
+    void for_each_with_name(std::string_view name, F&& func) const { for_each_in(name_index_, name, func); }
+
+    /**
+     * @brief 对场景中所有该标签的游戏对象调用 func（略过已标记移除的对象），只访问标签匹配的对象。
+     *        访问顺序不保证是加入场景的顺序（标签索引移除对象时与末尾交换）。
+     * @note 回调中可以添加对象；移除对象请使用 safe_remove_game_object()，不要在回调中修改对象的名称/标签。
+     */
+    template<typename F>
+    void for_each_with_tag(std::string_view tag, F&& func) const { for_each_in(tag_index_, tag, func); }
+
     // getters and setters
     void set_name(std::string_view name) { scene_name_ = name; }                ///< @brief 设置场景名称
     std::string_view get_name() const { return scene_name_; }                   ///< @brief 获取场景名称
 
     engine::core::Context& get_context() const { return context_; }                                         ///< @brief 获取上下文引用
     engine::scene::SceneManager& get_scene_manager() const { return scene_manager_; }                       ///< @brief 获取场景管理器引用
+    uint32_t get_residency_scope() const { return residency_scope_; }                                       ///< @brief 获取场景的资源驻留作用域
+    engine::render::AnimationSystem& get_animation_system() const { return *animation_system_; }             ///< @brief 获取场景的动画系统
+    engine::object::ObjectArena& get_object_arena() const { return *object_arena_; }                        ///< @brief 获取场景的对象内存池
     std::vector<std::unique_ptr<engine::object::GameObject>>& get_game_objects() { return game_objects_; }  ///< @brief 获取场景中的游戏对象
     
 protected:
     void process_pending_additions();                               ///< @brief 处理待添加的游戏对象。（每轮更新的最后调用）
+    void remove_pending_objects();                                  ///< @brief 一次性移除所有标记为需要移除的对象。（每轮更新的开始调用）
+
+    /**
+     * @brief 声明加载阶段要预加载的资源（enter() 时调用，默认不预加载）。
+     *        init() 中用到的资源都应加入清单，之后游戏过程中不再发生资源加载。
+     */
+    virtual void collect_resources(engine::resource::ResourceManifest& /*manifest*/) {}
 
     std::string scene_name_;                                        ///< @brief 场景名称
     engine::core::Context& context_;                                ///< @brief 上下文引用（显式，构造时传入）
     engine::scene::SceneManager& scene_manager_;                    ///< @brief 场景管理器引用
     std::unique_ptr<engine::ui::UIManager> ui_manager_ = nullptr;   ///< @brief UI管理器(初始化时自动创建)
+    uint32_t residency_scope_ = 0;                                  ///< @brief 资源驻留作用域（进入栈顶时由 SceneManager 激活，析构时释放）
+    /// @brief 对象内存池（声明在所有持有对象的成员之前，最后销毁）
+    std::unique_ptr<engine::object::ObjectArena> object_arena_ = nullptr;
+    /// @brief 动画系统（声明在游戏对象之前，保证对象中的动画组件先于系统销毁）
+    std::unique_ptr<engine::render::AnimationSystem> animation_system_ = nullptr;
 
-    std::vector<std::unique_ptr<engine::object::GameObject>> game_objects_;         ///< @brief 场景中的游戏对象
+    std::vector<std::unique_ptr<engine::object::GameObject>> game_objects_;         ///< @brief 场景中的游戏对象（顺序即渲染顺序）
     std::vector<std::unique_ptr<engine::object::GameObject>> pending_additions_;    ///< @brief 待添加的游戏对象（延时添加）
+    std::unique_ptr<engine::resource::PreloadBatch> loading_;                       ///< @brief 进行中的预加载（加载阶段结束后为空）
+
+private:
+    friend class engine::object::GameObject;        ///< @brief 对象改名/改标签时更新索引
+
+    /// @brief 名称/标签 -> 对象（名称索引按加入场景的顺序，标签索引无序）
+    using ObjectIndex = engine::utils::StringMap<std::vector<engine::object::GameObject*>>;
+
+    /// @brief 句柄表中的槽位
+    struct ObjectSlot {
+        engine::object::GameObject* object = nullptr;   ///< @brief 槽位中的对象（空闲时为 nullptr）
+        uint32_t generation = 0;                        ///< @brief 代数，对象移除时加一使旧句柄失效
+        uint32_t position = 0;                          ///< @brief 对象在 game_objects_ 中的下标
+        uint32_t tag_position = 0;                      ///< @brief 对象在标签索引列表中的下标（标签为空时无意义）
+    };
+
+    void register_object(engine::object::GameObject& game_object, uint32_t position);  ///< @brief 为新加入的对象分配句柄
+    void unregister_object(engine::object::GameObject& game_object);                   ///< @brief 回收对象的句柄
+    void index_object(engine::object::GameObject& game_object);                        ///< @brief 将对象加入名称/标签索引
+    void unindex_object(engine::object::GameObject& game_object);                      ///< @brief 将对象移出名称/标签索引
+
+    template<typename F>
+    static void for_each_in(const ObjectIndex& index, std::string_view key, F& func) {
+        auto it = index.find(key);
+        if (it == index.end()) return;
+        // 按下标遍历：回调中加入的同名对象追加在末尾，不会使遍历失效
+        const auto& objects = it->second;
+        for (size_t i = 0; i < objects.size(); ++i) {
+            if (!objects[i]->is_need_remove()) func(*objects[i]);
+        }
+    }
+
+    std::vector<ObjectSlot> object_slots_;          ///< @brief 句柄表（下标即句柄的 index）
+    std::vector<uint32_t> free_object_slots_;       ///< @brief 空闲槽位
+    ObjectIndex name_index_;                        ///< @brief 名称索引（不含空名称）
+    ObjectIndex tag_index_;                         ///< @brief 标签索引（不含空标签）
 };
 } // namespace engine::scene
\ No newline at end of file
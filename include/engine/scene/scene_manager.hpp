@@ -35,6 +35,7 @@ public:
 
     // getters
     Scene* get_current_scene() const;                                 ///< @brief 获取当前活动场景（栈顶场景）的指针。
+    void on_asset_changed(std::string_view path);                     ///< @brief 将资源文件变化通知转发给栈中所有场景（热重载）。
     engine::core::Context& get_context() const;                       ///< @brief 获取引擎上下文引用。
 
     // 核心循环函数
@@ -48,6 +49,7 @@ private:
     void push_scene(std::unique_ptr<Scene>&& scene);        ///< @brief 将一个新场景压入栈顶，使其成为活动场景。
     void pop_scene();                                       ///< @brief 移除栈顶场景。
     void replace_scene(std::unique_ptr<Scene>&& scene);     ///< @brief 清理场景栈所有场景，将此场景设为栈顶场景。
+    void activate_top_residency_scope();                    ///< @brief 将栈顶场景的驻留作用域设为当前记录作用域。
 
     engine::core::Context& context_;                        ///< @brief 引擎上下文引用
     std::vector<std::unique_ptr<Scene>> scene_stack_;        ///< @brief 场景栈
@@ -0,0 +1,79 @@
+#pragma once
+#include "level_data.hpp"
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine::scene {
+
+/**
+ * @brief 预处理后的单个瓦片定义
+ *
+ * 图块集加载时一次性解析全部属性（类型、碰撞盒、标签、动画、音效），
+ * 之后无论地图中引用多少次，按局部 id 下标访问即可，不再查找或解析 JSON。
+ */
+struct TileDefinition {
+    bool valid = false;                             ///< @brief 是否存在（多图片图块集的 id 可能不连续）
+    bool properties_valid = true;                   ///< @brief 动画/音效属性是否解析成功（失败时对象层跳过该对象）
+    uint32_t texture = 0;                           ///< @brief 图块集纹理表（Tileset::textures）下标
+    sf::IntRect rect;                               ///< @brief 源矩形
+    engine::component::TileType type{};             ///< @brief 瓦片类型
+    std::optional<sf::FloatRect> collider_rect;     ///< @brief 自定义碰撞盒（相对图片左上角）
+    std::optional<std::string> tag;                 ///< @brief "tag" 属性
+    std::optional<bool> gravity;                    ///< @brief "gravity" 属性
+    std::optional<int> health;                      ///< @brief "health" 属性
+    std::vector<AnimationData> animations;          ///< @brief "animation" 属性解析结果
+    std::vector<SoundData> sounds;                  ///< @brief "sound" 属性解析结果
+};
+
+/**
+ * @brief 预处理后的 Tiled 图块集（.tsj）
+ *
+ * 与地图无关（不含 firstgid），因此同一个图块集可以被多张地图共用。
+ */
+struct Tileset {
+    std::string path;                               ///< @brief 图块集文件路径
+    uint64_t content_hash = 0;                      ///< @brief 图块集文件内容的哈希（由 TilesetRegistry 填写，编译关卡据此判断是否过期）
+    std::vector<std::string> textures;              ///< @brief 图块集引用的图片路径（已解析为 "assets/..." 形式）
+    std::vector<TileDefinition> tiles;              ///< @brief 局部 id -> 瓦片定义
+
+    /// @brief 根据局部 id 获取瓦片定义，不存在返回 nullptr
+    const TileDefinition* get_tile(int local_id) const {
+        if (local_id < 0 || static_cast<size_t>(local_id) >= tiles.size() || !tiles[local_id].valid) return nullptr;
+        return &tiles[local_id];
+    }
+
+    /**
+     * @brief 从图块集 json 构建
+     * @param tileset_json 图块集 json 数据
+     * @param tileset_path 图块集文件路径（用于解析图片的相对路径）
+     * @return 图块集；缺少必要字段时返回 std::nullopt
+     */
+    static std::optional<Tileset> parse(const nlohmann::json& tileset_json, std::string_view tileset_path);
+
+    /**
+     * @brief 获取（地图、对象或瓦片的）自定义属性
+     * @tparam T 属性类型
+     * @return 属性值，如果属性不存在则返回 std::nullopt
+     */
+    template<typename T>
+    static std::optional<T> get_property(const nlohmann::json& json, std::string_view property_name) {
+        if (!json.contains("properties")) return std::nullopt;
+        for (const auto& property : json["properties"]) {
+            if (property.contains("name") && property["name"] == property_name && property.contains("value")) {
+                return property["value"].get<T>();
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief 解析图片路径，合并文件所在目录和相对路径。例如：
+     * 文件路径 "assets/maps/level1.tmj" + 相对路径 "../textures/Layers/back.png" -> "assets/textures/Layers/back.png"
+     */
+    static std::string resolve_path(std::string_view relative_path, std::string_view file_path);
+};
+
+} // namespace engine::scene
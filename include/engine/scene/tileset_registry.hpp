@@ -0,0 +1,55 @@
+#pragma once
+#include "tileset.hpp"
+#include "asset_archive.hpp"
+#include "string_hash.hpp"
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+
+namespace engine::scene {
+
+/**
+ * @brief 进程级的图块集缓存
+ *
+ * 各关卡共用同一批图块集（tileset.tsj、actor.tsj、prop.tsj），缓存预处理好的 Tileset，
+ * 切换关卡或回到标题时不再重复读取、解析。以规范化路径为键，并记录散文件的修改时间，
+ * 文件被修改（例如热重载时在 Tiled 中保存）后下一次获取会自动重新加载。
+ * 返回的是共享的只读数据，失效后仍在使用旧数据的解析过程不受影响。
+ */
+class TilesetRegistry final {
+public:
+    /// @brief 读取文件的方式（与 LevelParser::FileReader 相同）
+    using FileReader = std::function<std::optional<engine::resource::AssetData>(std::string_view path)>;
+
+    TilesetRegistry() = default;
+
+    TilesetRegistry(const TilesetRegistry&) = delete;
+    TilesetRegistry& operator=(const TilesetRegistry&) = delete;
+
+    /**
+     * @brief 获取图块集，未缓存或已过期时通过 read_file 读取并预处理
+     * @param tileset_path 图块集文件路径
+     * @param read_file 文件读取函数
+     * @return 图块集；读取或解析失败返回 nullptr（不缓存失败结果）
+     */
+    std::shared_ptr<const Tileset> get(std::string_view tileset_path, const FileReader& read_file);
+
+    void clear();                                       ///< @brief 清空缓存
+    size_t size() const;                                ///< @brief 已缓存的图块集数量
+
+private:
+    struct Entry {
+        std::shared_ptr<const Tileset> tileset;
+        std::optional<std::filesystem::file_time_type> mtime;  ///< @brief 散文件修改时间（只存在于资源包中时为空）
+    };
+
+    static std::optional<std::filesystem::file_time_type> get_mtime(std::string_view path);
+
+    mutable std::mutex mutex_;                          ///< @brief 保护 entries_（允许在工作线程上加载关卡）
+    engine::utils::StringMap<Entry> entries_;           ///< @brief 规范化路径 -> 缓存项
+};
+
+} // namespace engine::scene
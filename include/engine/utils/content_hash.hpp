@@ -0,0 +1,21 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace engine::utils {
+/**
+ * @brief 计算文件内容的 64 位 FNV-1a 哈希
+ *
+ * 用于判断编译产物（.slvl）所依赖的源文件是否被修改过：与修改时间不同，
+ * 对资源包中的文件同样有效，也不受 git 检出、复制等只改变时间戳的操作影响。不用于安全场合。
+ */
+inline uint64_t hash_content(std::span<const std::byte> bytes) {
+    uint64_t hash = 14695981039346656037ull;
+    for (auto byte : bytes) {
+        hash ^= static_cast<uint64_t>(byte);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+} // namespace engine::utils
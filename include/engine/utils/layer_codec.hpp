@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace engine::utils {
+/**
+ * @brief Tiled 图层数据的编码方式（"encoding" + "compression" 字段）
+ */
+enum class LayerCompression {
+    None,       ///< @brief 仅 base64
+    Zlib,       ///< @brief base64 + zlib
+    Gzip,       ///< @brief base64 + gzip
+    Zstd        ///< @brief base64 + zstd（需要编译时启用 zstd 支持）
+};
+
+/**
+ * @brief 根据 "compression" 字段的取值获取压缩方式
+ * @return 空字符串对应 None；未知取值返回 std::nullopt
+ */
+std::optional<LayerCompression> parse_layer_compression(std::string_view compression);
+
+/**
+ * @brief 解码 base64 字符串（标准字母表，允许末尾的 '=' 填充）
+ * @return 解码结果，含非法字符时返回 std::nullopt
+ */
+std::optional<std::vector<std::byte>> base64_decode(std::string_view text);
+
+/**
+ * @brief 解码 Tiled 的 base64 图层数据，直接解压到 gid 缓冲区
+ * @param text base64 文本
+ * @param compression 压缩方式
+ * @param gids 输出缓冲区，大小必须恰好等于瓦片数量（小端序 uint32）
+ * @return 数据完整且长度吻合时返回 true
+ */
+bool decode_layer_data(std::string_view text, LayerCompression compression, std::span<uint32_t> gids);
+
+bool zlib_decompress(std::span<const std::byte> input, std::span<std::byte> output);    ///< @brief zlib/gzip 解压（自动识别头部），长度必须吻合
+bool zstd_decompress(std::span<const std::byte> input, std::span<std::byte> output);    ///< @brief zstd 解压，长度必须吻合；未启用 zstd 时返回 false
+} // namespace engine::utils
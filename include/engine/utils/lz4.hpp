@@ -0,0 +1,24 @@
+#pragma once
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace engine::utils {
+/**
+ * @brief LZ4 块格式（block format）压缩
+ *
+ * 贪心匹配 + 单项哈希表的简单实现，输出与标准 LZ4 块解码器兼容。
+ * 主要供离线打包工具使用，运行时只需要解压。
+ * @param input 原始数据
+ * @return 压缩后的数据（不含原始长度，调用方需自行记录）
+ */
+std::vector<std::byte> lz4_compress(std::span<const std::byte> input);
+
+/**
+ * @brief LZ4 块格式解压
+ * @param input 压缩数据
+ * @param output 输出缓冲区，大小必须恰好等于原始数据长度
+ * @return 数据完整且长度吻合时返回 true，数据损坏返回 false（不会越界读写）
+ */
+bool lz4_decompress(std::span<const std::byte> input, std::span<std::byte> output);
+} // namespace engine::utils
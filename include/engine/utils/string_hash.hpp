@@ -0,0 +1,26 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <string>
+#include <string_view>
+
+namespace engine::utils {
+/**
+ * @brief 透明字符串哈希，配合 std::equal_to<> 使用
+ *
+ * 使 unordered_map<std::string, ...>::find 可以直接接受 std::string_view / const char*，
+ * 查找时不再构造临时 std::string。
+ */
+struct StringHash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view str) const noexcept { return std::hash<std::string_view>{}(str); }
+    size_t operator()(const std::string& str) const noexcept { return std::hash<std::string_view>{}(str); }
+    size_t operator()(const char* str) const noexcept { return std::hash<std::string_view>{}(str); }
+};
+
+/// @brief 以 std::string 为键、支持异构查找的哈希表
+template<typename Value>
+using StringMap = std::unordered_map<std::string, Value, StringHash, std::equal_to<>>;
+} // namespace engine::utils
@@ -1,4 +1,5 @@
 #pragma once
+#include "animation_id.hpp"
 #include <SFML/System/Time.hpp>
 #include <memory>
 #include <string>
@@ -13,6 +14,16 @@ namespace game::component {
 } // namespace game::component
 
 namespace game::component::state {
+/// @brief 玩家动画名称驻留后的 id（程序启动时驻留一次，状态切换时不再处理字符串）
+namespace animation_ids {
+inline const auto IDLE = engine::render::AnimationId::intern("idle");
+inline const auto WALK = engine::render::AnimationId::intern("walk");
+inline const auto JUMP = engine::render::AnimationId::intern("jump");
+inline const auto FALL = engine::render::AnimationId::intern("fall");
+inline const auto CLIMB = engine::render::AnimationId::intern("climb");
+inline const auto HURT = engine::render::AnimationId::intern("hurt");
+} // namespace animation_ids
+
 /**
  * @brief 玩家状态机的抽象基类。
  */
@@ -28,7 +39,7 @@ public:
     PlayerState(PlayerState&&) = delete;
     PlayerState& operator=(PlayerState&&) = delete;
 
-    void play_animation(std::string_view animation_name);      ///< @brief 播放指定名称的动画，使用 AnimationComponent 的方法
+    void play_animation(engine::render::AnimationId animation_id);     ///< @brief 播放指定 id 的动画，使用 AnimationComponent 的方法
 
 protected:
     /**
@@ -61,6 +61,8 @@ public:
     EndScene(EndScene&&) = delete;
     EndScene& operator=(EndScene&&) = delete;
 
+    void init() override;
+
 private:
     // 用于创建UI和按钮回调的私有辅助方法
     void create_ui();
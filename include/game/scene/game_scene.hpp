@@ -1,8 +1,10 @@
 #pragma once
 #include "scene.hpp"
+#include "resource_handle.hpp"
 #include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <memory>
+#include <optional>
 
 namespace engine::object {
     class GameObject;
@@ -24,15 +26,24 @@ namespace game::scene {
  */
 class GameScene final : public engine::scene::Scene {
 public:
+    /**
+     * @param player_position 若提供，玩家出生在该位置而不是地图中的位置（热重载关卡时保留玩家位置）
+     */
     GameScene(engine::core::Context& context
             , engine::scene::SceneManager& scene_manager
-            , std::shared_ptr<game::data::SessionData> data = nullptr);
+            , std::shared_ptr<game::data::SessionData> data = nullptr
+            , std::optional<sf::Vector2f> player_position = std::nullopt);
     ~GameScene();
     // 覆盖场景类的核心方法
+    void init() override;
     void update(sf::Time delta) override;
     void render() override;
     void handle_input() override;
+    void on_asset_changed(std::string_view path) override;  ///< @brief 当前关卡的地图或图块集变化时重新加载关卡
     
+protected:
+    void collect_resources(engine::resource::ResourceManifest& manifest) override;   ///< @brief 关卡清单 + 场景代码中直接使用的资源
+
 private:
     [[nodiscard]] bool init_level();
     [[nodiscard]] bool init_player();
@@ -65,10 +76,20 @@ private:
     void heal_with_ui(int amount);                    ///< @brief 增加生命，同时更新UI
     void update_health_with_ui();                     ///< @brief 更新生命值UI (只适用最大生命值不变的情况)
 
+    /// @brief 获取玩家对象，玩家不存在或已被移除时返回 nullptr
+    engine::object::GameObject* get_player() const { return get_game_object(player_handle_); }
+
     std::shared_ptr<game::data::SessionData> game_session_data_ = nullptr;      ///< @brief 场景间共享数据，因此用shared_ptr
-    engine::object::GameObject* player_obs_ = nullptr;                          ///< @brief 保存玩家对象的非拥有指针，方便访问
+    engine::object::GameObjectHandle player_handle_;                            ///< @brief 玩家对象的句柄（玩家被移除后自动失效）
+    std::optional<sf::Vector2f> player_spawn_override_;                         ///< @brief 覆盖地图中的玩家出生位置（热重载关卡时使用）
 
     engine::ui::UILabel* score_label_obs_ = nullptr;         ///< @brief 得分标签 (生命周期由UIManager管理，因此使用裸指针)
     engine::ui::UIPanel* health_panel_obs_ = nullptr;        ///< @brief 生命值图标面板
+
+    // --- 运行时使用的资源句柄（初始化时解析，避免每次使用都做字符串查找） ---
+    engine::resource::TextureHandle enemy_effect_texture_;   ///< @brief 敌人死亡特效纹理
+    engine::resource::TextureHandle item_effect_texture_;    ///< @brief 道具拾取特效纹理
+    engine::resource::SoundHandle stomp_sound_;              ///< @brief 踩踏敌人音效
+    engine::resource::SoundHandle pickup_sound_;             ///< @brief 拾取道具音效
 };
 }
\ No newline at end of file
@@ -45,6 +45,7 @@ public:
     HelpsScene& operator=(HelpsScene&&) = delete;
 
     // --- 核心方法 ---
+    void init() override;
     void handle_input() override;
 };
 } // namespace game::scene
\ No newline at end of file
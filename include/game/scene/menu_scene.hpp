@@ -39,6 +39,7 @@ public:
     ~MenuScene() override = default;
 
     // --- 核心循环方法 ---
+    void init() override;
     void handle_input() override;
 
 private:
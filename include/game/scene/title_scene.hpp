@@ -38,8 +38,12 @@ public:
     TitleScene& operator=(TitleScene&&) = delete;
 
     // --- 核心方法 --- //
+    void init() override;
     void update(sf::Time delta) override;
 
+protected:
+    void collect_resources(engine::resource::ResourceManifest& manifest) override;   ///< @brief 背景地图与 UI 用到的资源
+
 private:
     // 初始化 UI 元素
     void create_ui();
@@ -20,18 +20,35 @@ AudioPlayer::~AudioPlayer() {
 
 // ========================= 音效 =========================
 sf::Sound* AudioPlayer::play_sound(std::string_view sound_path, bool loop, std::optional<float> volume) {
-    // 清理播放结束的音效
-    std::erase_if(active_sounds_, [](const auto& s) {
-        return s->getStatus() == sf::SoundSource::Status::Stopped;
-    });
-
     auto* buffer = resource_manager_obs_->get_sound(sound_path);
     if (!buffer) {
         spdlog::error("AudioPlayer: 无法加载音效 '{}'", sound_path);
         return nullptr;
     }
+    spdlog::trace("AudioPlayer: 播放音效 '{}'", sound_path);
+    return play_buffer(*buffer, loop, volume);
+}
+
+sf::Sound* AudioPlayer::play_sound(engine::resource::SoundHandle sound, bool loop, std::optional<float> volume) {
+    auto* buffer = resource_manager_obs_->get_sound(sound);
+    if (!buffer) {
+        spdlog::error("AudioPlayer: 无法加载音效句柄 {}", sound.get_index());
+        return nullptr;
+    }
+    return play_buffer(*buffer, loop, volume);
+}
+
+engine::resource::SoundHandle AudioPlayer::get_sound_handle(std::string_view sound_path) {
+    return resource_manager_obs_->get_sound_handle(sound_path);
+}
+
+sf::Sound* AudioPlayer::play_buffer(const sf::SoundBuffer& buffer, bool loop, std::optional<float> volume) {
+    // 清理播放结束的音效
+    std::erase_if(active_sounds_, [](const auto& s) {
+        return s->getStatus() == sf::SoundSource::Status::Stopped;
+    });
 
-    auto sound = std::make_unique<sf::Sound>(*buffer);
+    auto sound = std::make_unique<sf::Sound>(buffer);
     if (volume.has_value())
     {
         sound->setVolume(std::clamp(volume.value(), 0.f, 100.f));
@@ -43,7 +60,7 @@ sf::Sound* AudioPlayer::play_sound(std::string_view sound_path, bool loop, std::
 
     active_sounds_.push_back(std::move(sound));
 
-    spdlog::trace("AudioPlayer: 播放音效 '{}', 音量: {}, 循环: {}", sound_path, volume.has_value() ? volume.value() : sound_volume_, loop);
+    spdlog::trace("AudioPlayer: 音量: {}, 循环: {}", volume.has_value() ? volume.value() : sound_volume_, loop);
     return active_sounds_.back().get();
 }
 
@@ -2,11 +2,17 @@
 #include "game_object.hpp"
 #include "sprite_component.hpp"
 #include "animation.hpp"
+#include "animation_system.hpp"
 #include <spdlog/spdlog.h>
+#include <algorithm>
 
 namespace engine::component{
-AnimationComponent::AnimationComponent(engine::object::GameObject* owner)
-    : Component{owner} {
+AnimationComponent::AnimationComponent(engine::object::GameObject* owner, engine::render::AnimationSystem* animation_system)
+    : Component{owner}
+    , animation_system_obs_{animation_system} {
+    if (!animation_system_obs_) {
+        spdlog::error("AnimationComponent构造函数中，AnimationSystem指针不能为nullptr！");
+    }
     sprite_component_obs_ = owner_->get_component<SpriteComponent>();
     if (!sprite_component_obs_) {
         spdlog::error("GameObject '{}' 的 AnimationComponent 需要 SpriteComponent，但未找到。", owner_->get_name());
@@ -14,37 +20,108 @@ AnimationComponent::AnimationComponent(engine::object::GameObject* owner)
     }
 }
 
-AnimationComponent::~AnimationComponent() = default;
+AnimationComponent::~AnimationComponent() {
+    if (is_playing()) animation_system_obs_->deactivate(state_index_);
+}
 
-void AnimationComponent::add_animation(std::unique_ptr<engine::render::Animation> animation) {
+void AnimationComponent::add_animation(const engine::render::Animation* animation) {
     if (!animation) return;
-    std::string_view name = animation->get_name();    // 获取名称
-    animations_[std::string(name)] = std::move(animation);
-    spdlog::debug("已将动画 '{}' 添加到 GameObject '{}'", name, owner_->get_name());
+    auto it = std::ranges::find(animations_, animation->get_id(), &Clip::id);
+    if (it != animations_.end()) {
+        if (current_animation_obs_ == it->animation) {
+            current_animation_obs_ = animation;
+            frame_cursor_ = 0;              // 新片段的帧数可能不同，游标从头开始
+            if (is_playing()) {
+                auto& state = animation_system_obs_->get_state(state_index_);
+                state.animation = animation;
+                state.frame = 0;
+            }
+        }
+        it->animation = animation;
+    } else {
+        animations_.push_back({animation->get_id(), animation});
+    }
+    spdlog::debug("已将动画 '{}' 添加到 GameObject '{}'", animation->get_name(), owner_->get_name());
+}
+
+void AnimationComponent::play_animation(engine::render::AnimationId id) {
+    auto it = std::ranges::find(animations_, id, &Clip::id);
+    if (it == animations_.end()) {
+        spdlog::warn("未找到 GameObject '{}' 的动画 '{}'", owner_->get_name(), id.get_name());
+        return;
+    }
+    start_animation(it->animation);
 }
 
 void AnimationComponent::play_animation(std::string_view name) {
-    auto it = animations_.find(std::string(name));
-    if (it == animations_.end() || !it->second) {
-        spdlog::warn("未找到 GameObject '{}' 的动画 '{}'", name, owner_->get_name());
+    auto it = std::ranges::find_if(animations_, [name](const Clip& clip) { return clip.animation->get_name() == name; });
+    if (it == animations_.end()) {
+        spdlog::warn("未找到 GameObject '{}' 的动画 '{}'", owner_->get_name(), name);
         return;
     }
+    start_animation(it->animation);
+}
 
+void AnimationComponent::start_animation(const engine::render::Animation* animation) {
     // 如果已经在播放相同的动画，不重新开始（注释这一段则重新开始播放）
-    if (current_animation_obs_ == it->second.get() && is_playing_) {
+    if (current_animation_obs_ == animation && is_playing()) {
         return;
     }
 
-    current_animation_obs_ = it->second.get();
+    current_animation_obs_ = animation;
     animation_timer_ = sf::Time::Zero;
-    is_playing_ = true;
+    frame_cursor_ = 0;
+    if (is_playing()) {             // 已占用槽位时原地切换片段
+        auto& state = animation_system_obs_->get_state(state_index_);
+        state.animation = animation;
+        state.timer = sf::Time::Zero;
+        state.frame = 0;
+    } else {
+        activate();
+    }
 
     // 立即将精灵更新到第一帧
     if (sprite_component_obs_ && !current_animation_obs_->is_empty()) {
-        const auto& first_frame = current_animation_obs_->get_frame(sf::Time::Zero);
+        const auto& first_frame = current_animation_obs_->get_frames().front();
         sf::Sprite& sprite = sprite_component_obs_->get_sprite();
         sprite.setTextureRect(first_frame.source_rect);
-        spdlog::debug("GameObject '{}' 播放动画 '{}'", owner_->get_name(), name);
+        spdlog::debug("GameObject '{}' 播放动画 '{}'", owner_->get_name(), current_animation_obs_->get_name());
+    }
+}
+
+void AnimationComponent::stop_animation() {
+    if (is_playing()) deactivate();
+}
+
+void AnimationComponent::resume_animation() {
+    if (!is_playing()) activate();
+}
+
+void AnimationComponent::activate() {
+    // 没有片段、没有精灵或片段没有帧时不占用槽位（与原先 update 中的检查一致）
+    if (!animation_system_obs_ || !current_animation_obs_ || !sprite_component_obs_ || current_animation_obs_->is_empty()) {
+        spdlog::trace("AnimationComponent 没有可播放的动画或精灵组件为空。");
+        return;
+    }
+    state_index_ = animation_system_obs_->activate({
+        current_animation_obs_, &sprite_component_obs_->get_sprite(), this, animation_timer_, frame_cursor_, false
+    });
+}
+
+void AnimationComponent::deactivate() {
+    const auto& state = animation_system_obs_->get_state(state_index_);
+    animation_timer_ = state.timer;
+    frame_cursor_ = state.frame;
+    animation_system_obs_->deactivate(state_index_);
+    state_index_ = INVALID_STATE;
+}
+
+void AnimationComponent::on_animation_finished(const engine::render::AnimationSystem::State& state) {
+    animation_timer_ = state.timer;
+    frame_cursor_ = state.frame;
+    state_index_ = INVALID_STATE;   // 槽位随后由系统归还
+    if (is_one_shot_removal_) {     // 如果 is_one_shot_removal_ 为 true，则删除整个 GameObject
+        owner_->set_need_remove(true);
     }
 }
 
@@ -55,38 +132,16 @@ std::string_view AnimationComponent::get_current_animation_name() const {
     return std::string_view();      // 返回一个空的string_view
 }
 
+engine::render::AnimationId AnimationComponent::get_current_animation_id() const {
+    return current_animation_obs_ ? current_animation_obs_->get_id() : engine::render::AnimationId();
+}
+
 bool AnimationComponent::is_animation_finished() const {
     // 如果没有当前动画(说明从未调用过playAnimation)，或者当前动画是循环的，则返回 false
     if (!current_animation_obs_ || current_animation_obs_->is_looping()) {
         return false;
     }
-    return animation_timer_ >= current_animation_obs_->get_total_duration();
-}
-
-void AnimationComponent::update(sf::Time delta, engine::core::Context&) {
-    // 如果没有正在播放的动画，或者没有当前动画，或者没有精灵组件，或者当前动画没有帧，则直接返回
-    if (!is_playing_ || !current_animation_obs_ || !sprite_component_obs_ || current_animation_obs_->is_empty()) {
-        spdlog::trace("AnimationComponent 更新时没有正在播放的动画或精灵组件为空。");
-        return;
-    }
-
-    // 推进计时器
-    animation_timer_ += delta;
-
-    // 根据时间获取当前帧
-    const auto& current_frame = current_animation_obs_->get_frame(animation_timer_);
-
-    // 更新精灵组件的源矩形 (使用 SpriteComponent 的新方法)
-    sf::Sprite& sprite = sprite_component_obs_->get_sprite();
-    sprite.setTextureRect(current_frame.source_rect);
-
-    // 检查非循环动画是否已结束
-    if (!current_animation_obs_->is_looping() && animation_timer_ >= current_animation_obs_->get_total_duration()) {
-        is_playing_ = false;
-        animation_timer_ = current_animation_obs_->get_total_duration(); // 将时间限制在结束点
-        if (is_one_shot_removal_) {     // 如果 is_one_shot_removal_ 为 true，则删除整个 GameObject
-            owner_->set_need_remove(true);
-        }
-    }
+    auto timer = is_playing() ? animation_system_obs_->get_state(state_index_).timer : animation_timer_;
+    return timer >= current_animation_obs_->get_total_duration();
 }
 } // namespace engine::component
\ No newline at end of file
@@ -22,8 +22,15 @@ AudioComponent::AudioComponent(engine::object::GameObject* owner, engine::audio:
 
 void AudioComponent::play_sound(std::string_view sound_id, bool use_spatial)
 {
-    // 如果 sound_id 是音效 ID，则在查找在map中查找对应的路径； 没找到的话则把 sound_id 当作路径直接使用
-    auto sound_path = sound_id_to_path_.find(std::string(sound_id)) != sound_id_to_path_.end() ? sound_id_to_path_[std::string(sound_id)] : sound_id;
+    // 如果 sound_id 是音效 ID，则在map中查找对应的句柄； 没找到的话则把 sound_id 当作路径直接使用
+    auto it = sound_id_to_handle_.find(sound_id);
+    auto play = [&]() {
+        if (it != sound_id_to_handle_.end()) {
+            audio_player_obs_->play_sound(it->second);
+        } else {
+            audio_player_obs_->play_sound(sound_id);
+        }
+    };
 
     if (use_spatial && transform_obs_) {    // 使用空间定位
         // TODO: (SDL_Mixer 不支持空间定位，未来更换音频库时可以方便地实现)
@@ -35,18 +42,24 @@ void AudioComponent::play_sound(std::string_view sound_id, bool use_spatial)
             spdlog::debug("AudioComponent::playSound: 音效 '{}' 超出范围，不播放。", sound_id);
             return; // 超出范围，不播放
         }
-        audio_player_obs_->play_sound(sound_path);
+        play();
     } else {    // 不使用空间定位
-        audio_player_obs_->play_sound(sound_path);
+        play();
     }
 }
 
 void AudioComponent::add_sound(std::string_view sound_id, std::string_view sound_path)
 {
-    if (sound_id_to_path_.find(std::string(sound_id)) != sound_id_to_path_.end()) {
+    add_sound(sound_id, audio_player_obs_->get_sound_handle(sound_path));
+    spdlog::debug("AudioComponent::add_sound: 添加音效 ID '{}' 路径 '{}'", sound_id, sound_path);
+}
+
+void AudioComponent::add_sound(std::string_view sound_id, engine::resource::SoundHandle handle) {
+    if (auto it = sound_id_to_handle_.find(sound_id); it != sound_id_to_handle_.end()) {
         spdlog::warn("AudioComponent::add_sound: 音效 ID '{}' 已存在，覆盖旧路径。", sound_id);
+        it->second = handle;
+    } else {
+        sound_id_to_handle_.emplace(sound_id, handle);
     }
-    sound_id_to_path_[std::string(sound_id)] = sound_path;
-    spdlog::debug("AudioComponent::add_sound: 添加音效 ID '{}' 路径 '{}'", sound_id, sound_path);
 }
 } // namespace engine::component
\ No newline at end of file
@@ -2,9 +2,21 @@
 #include "physics_engine.hpp"
 #include "context.hpp"
 #include "render.hpp"
+#include "camera.hpp"
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <climits>
+#include <cmath>
 
 namespace engine::component {
+namespace {
+/// @brief 向下取整的整数除法（负坐标同样落在正确的区块中）
+int floor_div(int value, int divisor) {
+    auto quotient = value / divisor;
+    return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? quotient - 1 : quotient;
+}
+} // namespace
+
 TileLayerComponent::TileLayerComponent(engine::object::GameObject* owner
                                      , sf::Vector2i tile_size
                                      , sf::Vector2i map_size
@@ -22,13 +34,49 @@ TileLayerComponent::TileLayerComponent(engine::object::GameObject* owner
     spdlog::trace("TileLayerComponent 构造完成");
 }
 
+TileLayerComponent::TileLayerComponent(engine::object::GameObject* owner
+                                     , sf::Vector2i tile_size
+                                     , sf::Vector2i chunk_size
+                                     , std::vector<TileChunk>&& chunks)
+    : Component{owner}
+    , tile_size_{std::move(tile_size)}
+    , map_size_{0, 0}
+    , chunk_size_{std::move(chunk_size)}
+    , chunks_{std::move(chunks)} {
+    if (chunk_size_.x <= 0 || chunk_size_.y <= 0) {
+        spdlog::error("TileLayerComponent: 无效的区块尺寸 ({}, {})，区块数据将被清除。", chunk_size_.x, chunk_size_.y);
+        chunks_.clear();
+        chunk_size_ = {1, 1};   // 保持区块模式，查询一律返回空瓦片
+    }
+    build_chunk_index();
+
+    spdlog::trace("TileLayerComponent 构造完成（区块模式，{} 个区块）", chunk_index_.size());
+}
+
 TileLayerComponent::~TileLayerComponent() {
     if (physics_engine_) {
         physics_engine_->unregister_collision_layer(this);
     }
 }
 
+bool TileLayerComponent::uses_texture(const sf::Texture* texture) const {
+    if (is_chunked()) {
+        return std::ranges::any_of(chunks_, [texture](const TileChunk& chunk) {
+            return std::ranges::any_of(chunk.tiles, [texture](const ChunkTile& tile) { return tile.texture == texture; });
+        });
+    }
+    return std::ranges::any_of(tiles_, [texture](const TileInfo& tile) {
+        return tile.type != TileType::Empty && &tile.sprite.getTexture() == texture;
+    });
+}
+
+sf::FloatRect TileLayerComponent::get_world_bounds() const {
+    auto origin = sf::Vector2f(static_cast<float>(origin_.x * tile_size_.x), static_cast<float>(origin_.y * tile_size_.y));
+    return sf::FloatRect(offset_ + origin, get_world_size());
+}
+
 const TileInfo* TileLayerComponent::get_tile_info_at(sf::Vector2i pos) const {
+    if (is_chunked()) return nullptr;   // 区块模式只保存紧凑数据，没有逐瓦片的精灵
     if (pos.x < 0 || pos.x >= map_size_.x || pos.y < 0 || pos.y >= map_size_.y) {
         spdlog::warn("TileLayerComponent: 瓦片坐标越界: ({}, {})", pos.x, pos.y);
         return nullptr;
@@ -42,6 +90,13 @@ const TileInfo* TileLayerComponent::get_tile_info_at(sf::Vector2i pos) const {
 }
 
 TileType TileLayerComponent::get_tile_type_at(sf::Vector2i pos) const {
+    if (is_chunked()) {
+        // 与渲染共用同一个区块索引；不在任何区块内的位置视为空瓦片（无限地图中很常见，不输出警告）
+        const auto* chunk = find_chunk({floor_div(pos.x, chunk_size_.x), floor_div(pos.y, chunk_size_.y)});
+        if (!chunk) return TileType::Empty;
+        auto local = pos - chunk->position;
+        return chunk->tiles[static_cast<size_t>(local.y) * chunk_size_.x + local.x].type;
+    }
     const TileInfo* info = get_tile_info_at(pos);
     return info ? info->type : TileType::Empty;
 }
@@ -154,6 +209,20 @@ void TileLayerComponent::render(engine::core::Context& context) {
         return;
     }
 
+    if (is_chunked()) {
+        // 相机在 update 之后才确定本帧位置，因此在渲染前按最终视野载入/卸载区块
+        auto& camera = context.get_camera();
+        if (cache_dirty_) {     // 纹理内容变化：重新烘焙已载入的区块
+            for (auto& [chunk, loaded] : loaded_chunks_) bake_chunk(chunk, loaded);
+            cache_dirty_ = false;
+        }
+        stream_chunks(camera.get_stream_bounds());
+        for (const auto& [chunk, loaded] : loaded_chunks_) {
+            context.get_renderer().draw_sprite(camera, *loaded.sprite);
+        }
+        return;
+    }
+
     // 检查是否需要重建缓存
     if (cache_dirty_ || !cached_sprite_) {
         rebuild_cache();
@@ -184,4 +253,121 @@ void TileLayerComponent::render(engine::core::Context& context) {
         }
     }
 }
+
+uint64_t TileLayerComponent::chunk_key(sf::Vector2i chunk_coord) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(chunk_coord.x)) << 32) | static_cast<uint32_t>(chunk_coord.y);
+}
+
+const TileChunk* TileLayerComponent::find_chunk(sf::Vector2i chunk_coord) const {
+    auto it = chunk_index_.find(chunk_key(chunk_coord));
+    return it != chunk_index_.end() ? &chunks_[it->second] : nullptr;
+}
+
+void TileLayerComponent::build_chunk_index() {
+    chunk_index_.clear();
+    chunk_index_.reserve(chunks_.size());
+    auto tile_count = static_cast<size_t>(chunk_size_.x) * chunk_size_.y;
+    sf::Vector2i min = {INT_MAX, INT_MAX};
+    sf::Vector2i max = {INT_MIN, INT_MIN};
+    for (uint32_t i = 0; i < chunks_.size(); ++i) {
+        const auto& chunk = chunks_[i];
+        // Tiled 的区块尺寸统一且按尺寸对齐，据此才能由瓦片坐标直接算出区块坐标
+        if (chunk.tiles.size() != tile_count || chunk.position.x % chunk_size_.x != 0 || chunk.position.y % chunk_size_.y != 0) {
+            spdlog::error("TileLayerComponent: 区块 ({}, {}) 的尺寸或位置与区块网格不符，已跳过。", chunk.position.x, chunk.position.y);
+            continue;
+        }
+        chunk_index_.emplace(chunk_key({chunk.position.x / chunk_size_.x, chunk.position.y / chunk_size_.y}), i);
+        min = {std::min(min.x, chunk.position.x), std::min(min.y, chunk.position.y)};
+        max = {std::max(max.x, chunk.position.x + chunk_size_.x), std::max(max.y, chunk.position.y + chunk_size_.y)};
+    }
+    if (chunk_index_.empty()) {
+        origin_ = {0, 0};
+        map_size_ = {0, 0};
+        return;
+    }
+    origin_ = min;
+    map_size_ = max - min;
+}
+
+void TileLayerComponent::stream_chunks(const sf::FloatRect& stream_bounds) {
+    // 流式范围覆盖的区块坐标范围
+    auto chunk_pixels = sf::Vector2f(static_cast<float>(chunk_size_.x * tile_size_.x), static_cast<float>(chunk_size_.y * tile_size_.y));
+    auto relative = stream_bounds.position - offset_;
+    auto first = sf::Vector2i(static_cast<int>(std::floor(relative.x / chunk_pixels.x)), static_cast<int>(std::floor(relative.y / chunk_pixels.y)));
+    auto last = sf::Vector2i(static_cast<int>(std::floor((relative.x + stream_bounds.size.x) / chunk_pixels.x)),
+                             static_cast<int>(std::floor((relative.y + stream_bounds.size.y) / chunk_pixels.y)));
+
+    // 卸载：超出范围一个区块以上才卸载（滞后），避免相机在区块边界附近来回移动时反复烘焙
+    for (auto it = loaded_chunks_.begin(); it != loaded_chunks_.end();) {
+        const auto& position = chunks_[it->first].position;
+        auto coord = sf::Vector2i(position.x / chunk_size_.x, position.y / chunk_size_.y);
+        if (coord.x < first.x - 1 || coord.x > last.x + 1 || coord.y < first.y - 1 || coord.y > last.y + 1) {
+            texture_pool_.push_back(std::move(it->second.texture));
+            it = loaded_chunks_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // 载入：范围内尚未载入的区块，优先复用回收的纹理
+    for (int y = first.y; y <= last.y; ++y) {
+        for (int x = first.x; x <= last.x; ++x) {
+            auto found = chunk_index_.find(chunk_key({x, y}));
+            if (found == chunk_index_.end() || loaded_chunks_.contains(found->second)) continue;
+            LoadedChunk loaded;
+            if (!texture_pool_.empty()) {
+                loaded.texture = std::move(texture_pool_.back());
+                texture_pool_.pop_back();
+            }
+            if (bake_chunk(found->second, loaded)) {
+                loaded_chunks_.emplace(found->second, std::move(loaded));
+            }
+        }
+    }
+}
+
+bool TileLayerComponent::bake_chunk(uint32_t chunk_index, LoadedChunk& loaded) const {
+    const auto& chunk = chunks_[chunk_index];
+    auto source_height = [](const ChunkTile& tile) {
+        return tile.rect.size.y > 0 ? tile.rect.size.y : static_cast<int>(tile.texture->getSize().y);
+    };
+
+    // 高于瓦片的精灵底部对齐，向上超出的部分需要额外空间
+    int extra_height = 0;
+    for (const auto& tile : chunk.tiles) {
+        if (tile.texture) extra_height = std::max(extra_height, source_height(tile) - tile_size_.y);
+    }
+    auto size = sf::Vector2u(static_cast<unsigned int>(chunk_size_.x * tile_size_.x),
+                             static_cast<unsigned int>(chunk_size_.y * tile_size_.y + extra_height));
+
+    if (!loaded.texture) loaded.texture = std::make_unique<sf::RenderTexture>();
+    auto& render_texture = *loaded.texture;
+    if (render_texture.getSize() != size && !render_texture.resize(size)) {
+        spdlog::error("TileLayerComponent: 无法创建区块 RenderTexture，大小 {}x{}", size.x, size.y);
+        return false;
+    }
+    render_texture.setView(render_texture.getDefaultView());
+    render_texture.clear(sf::Color::Transparent);
+
+    for (int y = 0; y < chunk_size_.y; ++y) {
+        for (int x = 0; x < chunk_size_.x; ++x) {
+            const auto& tile = chunk.tiles[static_cast<size_t>(y) * chunk_size_.x + x];
+            if (!tile.texture || tile.type == TileType::Empty) continue;
+            auto sprite = tile.rect.size == sf::Vector2i{} ? sf::Sprite(*tile.texture) : sf::Sprite(*tile.texture, tile.rect);
+            sprite.setPosition({static_cast<float>(x * tile_size_.x),
+                                static_cast<float>(extra_height + (y + 1) * tile_size_.y - source_height(tile))});
+            render_texture.draw(sprite);
+        }
+    }
+    render_texture.display();
+
+    if (!loaded.sprite) {
+        loaded.sprite = std::make_unique<sf::Sprite>(render_texture.getTexture());
+    } else {
+        loaded.sprite->setTexture(render_texture.getTexture(), true);
+    }
+    loaded.sprite->setPosition(offset_ + sf::Vector2f(static_cast<float>(chunk.position.x * tile_size_.x),
+                                                      static_cast<float>(chunk.position.y * tile_size_.y - extra_height)));
+    return true;
+}
 } // namespace engine::component
\ No newline at end of file
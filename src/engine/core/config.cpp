@@ -76,16 +76,28 @@ void Config::from_json(const nlohmann::json& json) {
     if (json.contains("graphics")) {
         const auto& graphics_config = json["graphics"];
         vsync_enabled_ = graphics_config.value("vsync", vsync_enabled_);
+        low_res_render_ = graphics_config.value("low_res_render", low_res_render_);
+        logical_size_.x = graphics_config.value("logical_width", logical_size_.x);
+        logical_size_.y = graphics_config.value("logical_height", logical_size_.y);
     }
     if (json.contains("performance")) {
         const auto& perf_config = json["performance"];
         target_fps_ = perf_config.value("target_fps", target_fps_);
+        texture_upload_budget_ms_ = perf_config.value("texture_upload_budget_ms", texture_upload_budget_ms_);
+        resource_budget_mb_ = perf_config.value("resource_budget_mb", resource_budget_mb_);
+        asset_archive_ = perf_config.value("asset_archive", asset_archive_);
+        chunk_load_radius_ = perf_config.value("chunk_load_radius", chunk_load_radius_);
     }
     if (json.contains("audio")) {
         const auto& audio_config = json["audio"];
         music_volume_ = audio_config.value("music_volume", music_volume_);
         sound_volume_ = audio_config.value("sound_volume", sound_volume_);
     }
+    if (json.contains("development")) {
+        const auto& dev_config = json["development"];
+        hot_reload_ = dev_config.value("hot_reload", hot_reload_);
+        hot_reload_level_ = dev_config.value("hot_reload_level", hot_reload_level_);
+    }
 
     // 从 JSON 加载 input_mappings
     if (json.contains("keyboard_input_mappings") && json["keyboard_input_mappings"].is_object()) {
@@ -128,15 +140,26 @@ nlohmann::ordered_json Config::to_json() const {
             {"resizable", window_resizable_}
         }},
         {"graphics", {
-            {"vsync", vsync_enabled_}
+            {"vsync", vsync_enabled_},
+            {"low_res_render", low_res_render_},
+            {"logical_width", logical_size_.x},
+            {"logical_height", logical_size_.y}
         }},
         {"performance", {
-            {"target_fps", target_fps_}
+            {"target_fps", target_fps_},
+            {"texture_upload_budget_ms", texture_upload_budget_ms_},
+            {"resource_budget_mb", resource_budget_mb_},
+            {"asset_archive", asset_archive_},
+            {"chunk_load_radius", chunk_load_radius_}
         }},
         {"audio", {
             {"music_volume", music_volume_},
             {"sound_volume", sound_volume_}
         }},
+        {"development", {
+            {"hot_reload", hot_reload_},
+            {"hot_reload_level", hot_reload_level_}
+        }},
         {"keyboard_input_mappings", keyboard_input_mappings_},
         {"mouse_input_mappings", mouse_input_mappings_}
     };
@@ -6,6 +6,7 @@
 #include "physics_engine.hpp"
 #include "audio_player.hpp"
 #include "game_state.hpp"
+#include "thread_pool.hpp"
 #include <spdlog/spdlog.h>
 
 namespace engine::core {
@@ -15,14 +16,18 @@ Context::Context(engine::input::InputManager& input_manager
                , engine::resource::ResourceManager& resource_manager
                , engine::physics::PhysicsEngine& physics_engine
                , engine::audio::AudioPlayer& audio_player
-               , engine::core::GameState& game_state)
+               , engine::core::GameState& game_state
+               , engine::core::ThreadPool& thread_pool
+               , engine::scene::TilesetRegistry& tileset_registry)
     : input_manager_{input_manager}
     , renderer_{renderer}
     , camera_{camera}
     , resource_manager_{resource_manager}
     , physics_engine_{physics_engine}
     , audio_player_{audio_player}
-    , game_state_{game_state} {
+    , game_state_{game_state}
+    , thread_pool_{thread_pool}
+    , tileset_registry_{tileset_registry} {
     spdlog::trace("上下文已创建并初始化");
 }
 } // namespace engine::core
\ No newline at end of file
@@ -1,10 +1,13 @@
 #include "game.hpp"
 #include "action.hpp"
 #include "time.hpp"
+#include "thread_pool.hpp"
 #include "config.hpp"
 #include "resource_manager.hpp"
+#include "asset_watcher.hpp"
 #include "input_manager.hpp"
 #include "scene_manager.hpp"
+#include "tileset_registry.hpp"
 #include "title_scene.hpp"
 #include "render.hpp"
 #include "camera.hpp"
@@ -14,31 +17,46 @@
 #include "game_state.hpp"
 #include "context.hpp"
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/System/Time.hpp>
 #include <spdlog/spdlog.h>
 
 namespace engine::core {
+namespace {
+constexpr std::string_view CONFIG_PATH = "assets/config.json";
+} // namespace
+
 Game::Game()
-    : config_{std::make_unique<Config>("assets/config.json")}
+    : config_{std::make_unique<Config>(CONFIG_PATH)}
     , window_{std::make_unique<sf::RenderWindow>(sf::VideoMode(config_->window_size_), config_->window_title_)}
     , time_{std::make_unique<Time>()}
-    , resource_manager_{std::make_unique<engine::resource::ResourceManager>()}
+    , thread_pool_{std::make_unique<ThreadPool>()}
+    , resource_manager_{std::make_unique<engine::resource::ResourceManager>(thread_pool_.get())}
     , input_manager_{std::make_unique<engine::input::InputManager>(window_.get(), config_.get())}
-    , renderer_{std::make_unique<engine::render::Renderer>(window_.get(), resource_manager_.get())}
+    , renderer_{std::make_unique<engine::render::Renderer>(window_.get(), resource_manager_.get(), config_.get(), thread_pool_.get())}
     , camera_{std::make_unique<engine::render::Camera>(window_.get())}
     , physics_engine_{std::make_unique<engine::physics::PhysicsEngine>()}
     , audio_player_{std::make_unique<engine::audio::AudioPlayer>(resource_manager_.get())}
     , game_state_{std::make_unique<engine::core::GameState>(window_.get())}
+    , tileset_registry_{std::make_unique<engine::scene::TilesetRegistry>()}
     , context_{std::make_unique<engine::core::Context>(*input_manager_
                                                      , *renderer_
                                                      , *camera_
                                                      , *resource_manager_
                                                      , *physics_engine_
                                                      , *audio_player_
-                                                     , *game_state_)}
+                                                     , *game_state_
+                                                     , *thread_pool_
+                                                     , *tileset_registry_)}
     , scene_manager_{std::make_unique<engine::scene::SceneManager>(*context_)} {
-    // 设置游戏音量（从 assets/config.json 里读取）
-    audio_player_->set_music_volume(config_->music_volume_);    // 设置背景音乐音量
-    audio_player_->set_sound_volume(config_->sound_volume_);    // 设置音效音量
+    apply_config();
+
+    if (config_->hot_reload_) {
+        // 热重载以磁盘上的散文件为准，因此不挂载资源包
+        asset_watcher_ = std::make_unique<engine::resource::AssetWatcher>();
+        if (!asset_watcher_->start("assets")) asset_watcher_.reset();
+    } else if (!config_->asset_archive_.empty()) {
+        resource_manager_->mount_archive(config_->asset_archive_);  // 失败时自动回退到散文件
+    }
 }
 
 Game::~Game() = default;
@@ -47,11 +65,10 @@ void Game::run() {
     // 调用场景设置函数(创建第一个场景并压入栈)
     scene_setup_func_(*scene_manager_);
 
-    time_->set_target_fps(config_->target_fps_);
-
     while (window_->isOpen()) {
         input_manager_->update();
         handle_event();
+        handle_asset_changes();
 
         time_->accumulate_frame_time();
         while (time_->should_update()) {
@@ -60,6 +77,7 @@ void Game::run() {
             handle_event();
             update(time_->get_frame_duration());
         }
+        resource_manager_->process_pending_loads(sf::seconds(config_->texture_upload_budget_ms_ / 1000.f));
         render();
     }
 }
@@ -84,11 +102,38 @@ void Game::update(sf::Time delta) {
     scene_manager_->update(delta);
 }
 
+void Game::handle_asset_changes() {
+    if (!asset_watcher_) return;
+    for (const auto& path : asset_watcher_->consume_changes()) {
+        if (path == CONFIG_PATH) {
+            if (config_->load_from_file(CONFIG_PATH)) {
+                apply_config();
+                spdlog::info("已重新加载配置 '{}'", path);
+            }
+            continue;
+        }
+
+        resource_manager_->reload(path);    // 已加载的纹理/音效原地更新
+        bool is_map = path.ends_with(".tmj") || path.ends_with(".tsj");
+        if (is_map && !config_->hot_reload_level_) continue;
+        scene_manager_->on_asset_changed(path);
+    }
+}
+
+void Game::apply_config() {
+    // 设置游戏音量（从 assets/config.json 里读取）
+    audio_player_->set_music_volume(config_->music_volume_);    // 设置背景音乐音量
+    audio_player_->set_sound_volume(config_->sound_volume_);    // 设置音效音量
+    resource_manager_->set_memory_budget(static_cast<size_t>(config_->resource_budget_mb_) * 1024 * 1024);
+    time_->set_target_fps(config_->target_fps_);
+    camera_->set_stream_radius(config_->chunk_load_radius_);
+}
+
 void Game::render() {
-    window_->clear();
+    renderer_->clear_frame();
 
     scene_manager_->render();
 
-    window_->display();
+    renderer_->display_frame();
 }
 } // namespace engine::core
\ No newline at end of file
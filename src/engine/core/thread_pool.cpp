@@ -0,0 +1,127 @@
+#include "thread_pool.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace engine::core {
+namespace {
+/**
+ * @brief 一次 parallel_for 调用的共享状态
+ *
+ * 参与的线程通过 next_chunk 认领块；迟到的工作线程认领失败后直接返回，不会访问 func，
+ * 因此调用返回后仍在队列中的辅助任务也是安全的（状态由 shared_ptr 保活）。
+ */
+struct ParallelForState {
+    const std::function<void(size_t begin, size_t end)>* func = nullptr;
+    size_t count = 0;
+    size_t chunk_size = 0;
+    size_t chunk_count = 0;
+    std::atomic<size_t> next_chunk{0};          ///< @brief 下一个待认领的块
+    std::atomic<size_t> finished_chunks{0};     ///< @brief 已执行完的块数
+    std::mutex error_mutex;                     ///< @brief 保护 error
+    std::exception_ptr error;                   ///< @brief 第一个异常
+
+    /// @brief 认领并执行块，直到没有剩余的块
+    void run() {
+        while (true) {
+            size_t chunk = next_chunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= chunk_count) return;
+            size_t begin = chunk * chunk_size;
+            try {
+                (*func)(begin, std::min(begin + chunk_size, count));
+            } catch (...) {
+                std::lock_guard lock(error_mutex);
+                if (!error) error = std::current_exception();
+            }
+            if (finished_chunks.fetch_add(1, std::memory_order_acq_rel) + 1 == chunk_count) {
+                finished_chunks.notify_all();
+            }
+        }
+    }
+};
+} // namespace
+
+ThreadPool::ThreadPool(size_t thread_count) {
+    if (thread_count == 0) {
+        auto hardware_threads = static_cast<size_t>(std::thread::hardware_concurrency());
+        thread_count = hardware_threads > 1 ? hardware_threads - 1 : 1;    // 留一个核心给主线程
+    }
+    workers_.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+        workers_.emplace_back([this]() { worker_loop(); });
+    }
+    spdlog::trace("ThreadPool 初始化完成，工作线程数: {}", thread_count);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    condition_.notify_all();
+    workers_.clear();       // jthread 析构时自动 join
+    spdlog::trace("ThreadPool 已销毁");
+}
+
+void ThreadPool::parallel_for(size_t count, size_t min_chunk, const std::function<void(size_t begin, size_t end)>& func) {
+    if (count == 0) return;
+    min_chunk = std::max<size_t>(min_chunk, 1);
+
+    // 块数 = min(参与线程数, 按最小块大小可切出的块数)，调用线程也参与执行
+    size_t participants = workers_.size() + 1;
+    size_t chunk_count = std::min(participants, (count + min_chunk - 1) / min_chunk);
+    if (chunk_count <= 1) {
+        func(0, count);
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>();
+    state->func = &func;
+    state->count = count;
+    state->chunk_size = (count + chunk_count - 1) / chunk_count;
+    state->chunk_count = (count + state->chunk_size - 1) / state->chunk_size;
+
+    // 每个辅助任务都会循环认领块；辅助任务进入优先队列，空闲的工作线程先于排队的解码任务执行它们，
+    // 即使所有工作线程都忙，迟迟没有开始的辅助任务也不影响本次调用
+    try {
+        std::lock_guard lock(mutex_);
+        for (size_t i = 1; i < state->chunk_count; ++i) {
+            urgent_tasks_.emplace([state]() { state->run(); });
+        }
+    } catch (...) {
+        // 投递失败不影响结果：没有工作线程认领的块由调用线程执行
+    }
+    condition_.notify_all();
+    state->run();
+
+    // 调用线程认领不到新块后，只等待已被工作线程认领、正在执行的块；任一块抛出异常时其余块照常执行，
+    // 全部结束后再重新抛出第一个异常
+    size_t finished = state->finished_chunks.load(std::memory_order_acquire);
+    while (finished != state->chunk_count) {
+        state->finished_chunks.wait(finished, std::memory_order_acquire);
+        finished = state->finished_chunks.load(std::memory_order_acquire);
+    }
+    if (state->error) std::rethrow_exception(state->error);
+}
+
+void ThreadPool::worker_loop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock lock(mutex_);
+            condition_.wait(lock, [this]() { return stopping_ || !tasks_.empty() || !urgent_tasks_.empty(); });
+            if (!urgent_tasks_.empty()) {
+                task = std::move(urgent_tasks_.front());
+                urgent_tasks_.pop();
+            } else if (!tasks_.empty()) {
+                task = std::move(tasks_.front());
+                tasks_.pop();
+            } else {
+                return;     // 正在停止且没有剩余任务
+            }
+        }
+        task();
+    }
+}
+} // namespace engine::core
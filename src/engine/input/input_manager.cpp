@@ -90,8 +90,12 @@ sf::Vector2i InputManager::get_mouse_position_window() const {
 sf::Vector2i InputManager::get_mouse_logical_position() const {
     const sf::View& view = window_obs_->getView();
     sf::Vector2i mouse_position = get_mouse_position_window();
-    sf::Vector2f scale = view.getSize().componentWiseDiv(static_cast<sf::Vector2f>(window_obs_->getSize()));
-    sf::Vector2f logical_position = static_cast<sf::Vector2f>(mouse_position).componentWiseMul(scale);
+    // 视口可能不是整个窗口（低分辨率模式下整数放大后会有黑边），需要先减去视口偏移
+    sf::Vector2f window_size = static_cast<sf::Vector2f>(window_obs_->getSize());
+    sf::Vector2f viewport_pos = view.getViewport().position.componentWiseMul(window_size);
+    sf::Vector2f viewport_size = view.getViewport().size.componentWiseMul(window_size);
+    sf::Vector2f scale = view.getSize().componentWiseDiv(viewport_size);
+    sf::Vector2f logical_position = (static_cast<sf::Vector2f>(mouse_position) - viewport_pos).componentWiseMul(scale);
     return static_cast<sf::Vector2i>(logical_position);
 }
 
@@ -1,27 +1,93 @@
 #include "game_object.hpp"
+#include "scene.hpp"
 #include <SFML/System/Time.hpp>
-#include <ranges>
+#include <atomic>
+#include <cstddef>
 
 namespace engine::object {
-GameObject::GameObject(std::string_view name, std::string_view tag)
-    : name_{name}
-    , tag_{tag} {
+namespace detail {
+ComponentTypeId next_component_type_id() {
+    static std::atomic<ComponentTypeId> next_id{0};     // 关卡加载时可能在工作线程中首次添加某类组件
+    return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+} // namespace detail
+
+namespace {
+// 分配块前部保存所属内存池指针，保持对象按最大基本对齐
+constexpr std::size_t ARENA_HEADER_SIZE = alignof(std::max_align_t);
+static_assert(ARENA_HEADER_SIZE >= sizeof(ObjectArena*));
+} // namespace
+
+GameObject::GameObject(std::string_view name, std::string_view tag, ObjectArena* arena)
+    : arena_{arena ? arena : &ObjectArena::get_default()}
+    , name_{name, arena_}
+    , tag_{tag, arena_}
+    , lookup_{arena_}
+    , components_{arena_} {
+}
+
+GameObject::~GameObject() {
+    // 按添加的逆序销毁组件：后添加的组件（例如物理组件）析构时可能还会访问先添加的组件
+    while (!components_.empty()) components_.pop_back();
+}
+
+void GameObject::set_name(std::string_view name) {
+    if (name_ == name) return;
+    if (scene_obs_) scene_obs_->unindex_object(*this);
+    name_ = name;
+    if (scene_obs_) scene_obs_->index_object(*this);
+}
+
+void GameObject::set_tag(std::string_view tag) {
+    if (tag_ == tag) return;
+    if (scene_obs_) scene_obs_->unindex_object(*this);
+    tag_ = tag;
+    if (scene_obs_) scene_obs_->index_object(*this);
+}
+
+std::unique_ptr<GameObject> GameObject::create(ObjectArena& arena, std::string_view name, std::string_view tag) {
+    return std::unique_ptr<GameObject>(new (arena) GameObject(name, tag, &arena));
+}
+
+void* GameObject::operator new(std::size_t size) {
+    return operator new(size, ObjectArena::get_default());
+}
+
+void* GameObject::operator new(std::size_t size, ObjectArena& arena) {
+    auto* block = static_cast<std::byte*>(arena.allocate(size + ARENA_HEADER_SIZE, alignof(std::max_align_t)));
+    *reinterpret_cast<ObjectArena**>(block) = &arena;
+    return block + ARENA_HEADER_SIZE;
+}
+
+void GameObject::operator delete(void* ptr, std::size_t size) {
+    if (!ptr) return;
+    auto* block = static_cast<std::byte*>(ptr) - ARENA_HEADER_SIZE;
+    auto* arena = *reinterpret_cast<ObjectArena**>(block);
+    arena->deallocate(block, size + ARENA_HEADER_SIZE, alignof(std::max_align_t));
+}
+
+void GameObject::operator delete(void* ptr, ObjectArena& arena) {
+    auto* block = static_cast<std::byte*>(ptr) - ARENA_HEADER_SIZE;
+    arena.deallocate(block, sizeof(GameObject) + ARENA_HEADER_SIZE, alignof(std::max_align_t));
 }
 
 void GameObject::handle_input(engine::core::Context& context) {
-    for (auto& component : components_ | std::views::values) {
+    for (size_t i = 0; i < components_.size(); ++i) {    // 按下标遍历：组件在回调中添加其它组件也是安全的
+        auto& component = components_[i];
         component->handle_input(context);
     }
 }
 
 void GameObject::update(sf::Time delta, engine::core::Context& context) {
-    for (auto& component : components_ | std::views::values) {
+    for (size_t i = 0; i < components_.size(); ++i) {
+        auto& component = components_[i];
         component->update(delta, context);
     }
 }
 
 void GameObject::render(engine::core::Context& context) {
-    for (auto& component : components_ | std::views::values) {
+    for (size_t i = 0; i < components_.size(); ++i) {
+        auto& component = components_[i];
         component->render(context);
     }
 }
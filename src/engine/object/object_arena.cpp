@@ -0,0 +1,65 @@
+#include "object_arena.hpp"
+#include <spdlog/spdlog.h>
+
+namespace engine::object {
+ObjectArena::ObjectArena(std::string_view name)
+    : name_{name}
+    , pool_{&upstream_} {
+}
+
+ObjectArena::~ObjectArena() {
+    pools_.clear();     // 先归还组件池的内存块，统计才准确
+    log_stats("释放");
+    if (auto in_use = bytes_in_use_.load(std::memory_order_relaxed); in_use > 0) {
+        spdlog::warn("对象内存池 '{}' 销毁时仍有 {} 字节未归还", name_, in_use);
+    }
+}
+
+ObjectArena& ObjectArena::get_default() {
+    // 有意不销毁：进程退出时的静态析构顺序不确定，此时日志系统可能已经销毁
+    static auto* arena = new ObjectArena("default");
+    return *arena;
+}
+
+ObjectArena::Stats ObjectArena::get_stats() const {
+    return {
+        allocation_count_.load(std::memory_order_relaxed),
+        allocated_bytes_.load(std::memory_order_relaxed),
+        bytes_in_use_.load(std::memory_order_relaxed),
+        peak_bytes_.load(std::memory_order_relaxed),
+        upstream_.reserved_bytes.load(std::memory_order_relaxed)
+    };
+}
+
+void ObjectArena::log_stats(std::string_view when) const {
+    auto stats = get_stats();
+    spdlog::info("对象内存池 '{}' {}：{} 次分配共 {} 字节，使用中 {} 字节，峰值 {} 字节，向系统申请 {} 字节",
+                 name_, when, stats.allocation_count, stats.allocated_bytes, stats.bytes_in_use, stats.peak_bytes, stats.reserved_bytes);
+}
+
+void* ObjectArena::do_allocate(size_t bytes, size_t alignment) {
+    void* p = pool_.allocate(bytes, alignment);
+    allocation_count_.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    auto in_use = bytes_in_use_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    auto peak = peak_bytes_.load(std::memory_order_relaxed);
+    while (in_use > peak && !peak_bytes_.compare_exchange_weak(peak, in_use, std::memory_order_relaxed)) {}
+    return p;
+}
+
+void ObjectArena::do_deallocate(void* p, size_t bytes, size_t alignment) {
+    pool_.deallocate(p, bytes, alignment);
+    bytes_in_use_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void* ObjectArena::Upstream::do_allocate(size_t bytes, size_t alignment) {
+    void* p = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    reserved_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    return p;
+}
+
+void ObjectArena::Upstream::do_deallocate(void* p, size_t bytes, size_t alignment) {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    reserved_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+} // namespace engine::object
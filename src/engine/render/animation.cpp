@@ -1,9 +1,11 @@
 #include "animation.hpp"
 #include <spdlog/spdlog.h>
+#include <algorithm>
 
 namespace engine::render{
 Animation::Animation(std::string_view name, bool loop)
     : name_{name}
+    , id_{AnimationId::intern(name)}
     , loop_{loop} {
 }
 
@@ -14,6 +16,14 @@ void Animation::add_frame(const sf::IntRect& source_rect, sf::Time duration) {
     }
     frames_.push_back({source_rect, duration});
     total_duration_ += duration;
+    frame_ends_.push_back(total_duration_.asMicroseconds());
+
+    // 维护“等时长”快速路径：首帧确定时长，之后任何一帧不同即退回二分查找
+    if (frames_.size() == 1) {
+        uniform_duration_ = duration.asMicroseconds();
+    } else if (uniform_duration_ != duration.asMicroseconds()) {
+        uniform_duration_ = 0;
+    }
 }
 
 const AnimationFrame& Animation::get_frame(sf::Time time) const {
@@ -21,31 +31,41 @@ const AnimationFrame& Animation::get_frame(sf::Time time) const {
         spdlog::error("动画 '{}' 没有帧，无法获取帧", name_);
         return frames_.back();      // 返回最后一帧（空的）
     }
+    return frames_[get_frame_index(time)];
+}
 
-    sf::Time current_time = time;
-
-    if (loop_ && total_duration_ > sf::Time::Zero) {
-        // 对循环动画使用模运算获取有效时间
-        float mod_time = std::fmod(time.asSeconds(), total_duration_.asSeconds());
-        current_time = sf::seconds(mod_time);
-    } else {
-        // 对于非循环动画，如果时间超过总时长，则停留在最后一帧
-        if (current_time >= total_duration_) {
-            return frames_.back();
-        }
+size_t Animation::get_frame_index(sf::Time time) const {
+    auto t = local_time(time);
+    if (t < 0) return frames_.size() - 1;       // 非循环动画已播放完毕，停留在最后一帧
+    if (uniform_duration_ > 0) {
+        return static_cast<size_t>(t / uniform_duration_);
     }
+    // 第一个结束时刻大于 t 的帧即为当前帧
+    auto it = std::ranges::upper_bound(frame_ends_, t);
+    return static_cast<size_t>(it - frame_ends_.begin());
+}
 
-    // 遍历帧以找到正确的帧
-    sf::Time accumulated_time = sf::Time::Zero;
-    for (const auto& frame : frames_) {
-        accumulated_time += frame.duration;
-        if (current_time < accumulated_time) {
-            return frame;
-        }
+size_t Animation::advance_frame_index(size_t cursor, sf::Time time) const {
+    auto t = local_time(time);
+    if (t < 0) return frames_.size() - 1;
+    if (uniform_duration_ > 0) {
+        return static_cast<size_t>(t / uniform_duration_);
+    }
+    // 游标越界或时间回到了游标所在帧之前（循环回绕），从第一帧开始前进
+    if (cursor >= frames_.size() || (cursor > 0 && t < frame_ends_[cursor - 1])) {
+        cursor = 0;
     }
+    while (t >= frame_ends_[cursor]) {          // t < total_duration_ = frame_ends_.back()，循环必然终止
+        ++cursor;
+    }
+    return cursor;
+}
 
-    // 理论上在不应到达这里，但为了安全起见，返回最后一帧
-    spdlog::warn("动画 '{}' 在获取帧信息时出现错误。", name_);
-    return frames_.back();
+std::int64_t Animation::local_time(sf::Time time) const {
+    auto t = std::max<std::int64_t>(time.asMicroseconds(), 0);
+    auto total = total_duration_.asMicroseconds();
+    if (t < total) return t;
+    if (!loop_ || total <= 0) return -1;
+    return t % total;                           // sf::Time 以整数微秒储存，取模没有浮点误差
 }
 } // namespace engine::render
\ No newline at end of file
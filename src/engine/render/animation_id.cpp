@@ -0,0 +1,40 @@
+#include "animation_id.hpp"
+#include "string_hash.hpp"
+#include <deque>
+#include <mutex>
+#include <string>
+
+namespace engine::render {
+namespace {
+/// @brief 进程级名称表。deque 追加元素时不移动已有字符串，get_name 返回的视图始终有效
+struct NameTable {
+    std::mutex mutex;
+    engine::utils::StringMap<uint32_t> indices;
+    std::deque<std::string> names;
+};
+
+NameTable& get_name_table() {
+    static NameTable table;     // 函数内静态变量，文件作用域常量在静态初始化阶段调用 intern 也是安全的
+    return table;
+}
+} // namespace
+
+AnimationId AnimationId::intern(std::string_view name) {
+    auto& table = get_name_table();
+    std::lock_guard lock(table.mutex);
+    if (auto it = table.indices.find(name); it != table.indices.end()) {
+        return AnimationId(it->second);
+    }
+    auto index = static_cast<uint32_t>(table.names.size());
+    table.names.emplace_back(name);
+    table.indices.emplace(table.names.back(), index);
+    return AnimationId(index);
+}
+
+std::string_view AnimationId::get_name() const {
+    if (!is_valid()) return {};
+    auto& table = get_name_table();
+    std::lock_guard lock(table.mutex);
+    return index_ < table.names.size() ? std::string_view(table.names[index_]) : std::string_view();
+}
+} // namespace engine::render
@@ -0,0 +1,82 @@
+#include "animation_system.hpp"
+#include "animation.hpp"
+#include "animation_component.hpp"
+#include "context.hpp"
+#include "thread_pool.hpp"
+#include <SFML/Graphics/Sprite.hpp>
+#include <spdlog/spdlog.h>
+#include <atomic>
+
+namespace engine::render {
+namespace {
+// 活动动画达到该数量才分块并行推进，否则线程调度的开销大于收益
+constexpr size_t PARALLEL_THRESHOLD = 4096;
+constexpr size_t PARALLEL_CHUNK_SIZE = 1024;
+} // namespace
+
+uint32_t AnimationSystem::activate(const State& state) {
+    states_.push_back(state);
+    return static_cast<uint32_t>(states_.size() - 1);
+}
+
+void AnimationSystem::deactivate(uint32_t index) {
+    if (index >= states_.size()) {
+        spdlog::warn("AnimationSystem：尝试归还无效的槽位 {}", index);
+        return;
+    }
+    if (index != states_.size() - 1) {
+        states_[index] = states_.back();
+        states_[index].component->state_index_ = index;     // 被移动的组件更新自己的槽位下标
+    }
+    states_.pop_back();
+}
+
+void AnimationSystem::update(sf::Time delta, engine::core::Context& context) {
+    if (states_.empty()) return;
+
+    size_t finished_count = 0;
+    if (states_.size() >= PARALLEL_THRESHOLD) {
+        // 每个槽位只写自己的状态和自己的精灵，块之间没有共享数据
+        std::atomic<size_t> finished{0};
+        context.get_thread_pool().parallel_for(states_.size(), PARALLEL_CHUNK_SIZE, [&](size_t begin, size_t end) {
+            if (auto count = advance(begin, end, delta); count > 0) finished.fetch_add(count, std::memory_order_relaxed);
+        });
+        finished_count = finished.load(std::memory_order_relaxed);
+    } else {
+        finished_count = advance(0, states_.size(), delta);
+    }
+    if (finished_count == 0) return;
+
+    // 收尾：从后向前移出播放完毕的动画（移入的末尾元素已经检查过，不会遗漏）
+    for (auto i = states_.size(); i-- > 0;) {
+        if (!states_[i].finished) continue;
+        auto* component = states_[i].component;
+        component->on_animation_finished(states_[i]);
+        deactivate(static_cast<uint32_t>(i));
+    }
+}
+
+size_t AnimationSystem::advance(size_t begin, size_t end, sf::Time delta) {
+    size_t finished_count = 0;
+    for (auto i = begin; i < end; ++i) {
+        auto& state = states_[i];
+        const auto& animation = *state.animation;
+        state.timer += delta;
+
+        // 从帧游标出发查找当前帧，只有帧发生变化时才更新精灵的源矩形
+        auto frame = static_cast<uint32_t>(animation.advance_frame_index(state.frame, state.timer));
+        if (frame != state.frame) {
+            state.frame = frame;
+            state.sprite->setTextureRect(animation.get_frames()[frame].source_rect);
+        }
+
+        // 检查非循环动画是否已结束
+        if (!animation.is_looping() && state.timer >= animation.get_total_duration()) {
+            state.timer = animation.get_total_duration();     // 将时间限制在结束点
+            state.finished = true;
+            ++finished_count;
+        }
+    }
+    return finished_count;
+}
+} // namespace engine::render
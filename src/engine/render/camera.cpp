@@ -49,6 +49,11 @@ void Camera::update(sf::Time delta_time) {
     clamp_position();
 }
 
+sf::FloatRect Camera::get_stream_bounds() const {
+    auto size = world_view_.getSize() + sf::Vector2f(stream_radius_, stream_radius_) * 2.f;
+    return sf::FloatRect(world_view_.getCenter() - size / 2.f, size);
+}
+
 void Camera::set_world_view_center(sf::Vector2f center) {
     world_view_.setCenter(center);
     clamp_position();
@@ -1,18 +1,27 @@
 #include "render.hpp"
 #include "resource_manager.hpp"
 #include "camera.hpp"
+#include "config.hpp"
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 #include <iostream>
+#include <algorithm>
+#include <cmath>
 
 namespace engine::render {
-Renderer::Renderer(sf::RenderWindow* window, engine::resource::ResourceManager* resource_manager)
+Renderer::Renderer(sf::RenderWindow* window
+                 , engine::resource::ResourceManager* resource_manager
+                 , const engine::core::Config* config
+                 , engine::core::ThreadPool* thread_pool)
     : window_obs_{window}
-    , resourec_manager_obs_{resource_manager} {
+    , resourec_manager_obs_{resource_manager}
+    , target_obs_{window}
+    , thread_pool_obs_{thread_pool} {
     spdlog::trace("构造 Renderer...");
     if (!window_obs_) {
         throw std::runtime_error("Renderer 构造失败：提供的 window 指针为空");
@@ -20,20 +29,88 @@ Renderer::Renderer(sf::RenderWindow* window, engine::resource::ResourceManager*
     if (!resourec_manager_obs_) {
         throw std::runtime_error("ResourceManager 构造失败：提供的 ResourceManager 指针为空");
     }
+
+    if (config && config->low_res_render_) {
+        auto render_texture = std::make_unique<sf::RenderTexture>();
+        if (render_texture->resize(config->logical_size_)) {
+            render_texture->setSmooth(false);       // 最近邻采样，保证放大后像素清晰
+            render_texture_ = std::move(render_texture);
+            target_obs_ = render_texture_.get();
+            spdlog::info("Renderer 开启低分辨率渲染，逻辑分辨率 {}x{}", config->logical_size_.x, config->logical_size_.y);
+        } else {
+            spdlog::error("无法创建 {}x{} 的离屏渲染纹理，回退到直接绘制窗口", config->logical_size_.x, config->logical_size_.y);
+        }
+    }
     spdlog::trace("Renderer 构造成功");
 }
 
+Renderer::~Renderer() = default;
+
 void Renderer::clear_frame() {
+    if (render_texture_) {
+        render_texture_->clear(sf::Color::Black);
+    }
     window_obs_->clear(sf::Color::Black);
 }
 
 void Renderer::display_frame() {
+    flush_batch();
+    if (render_texture_) {
+        present_low_res();
+    }
     window_obs_->display();
 }
 
+void Renderer::present_low_res() {
+    render_texture_->display();
+
+    // 计算整数缩放倍数（至少为1），并使画面居中，剩余部分留黑边
+    sf::Vector2u logical_size = render_texture_->getSize();
+    sf::Vector2u window_size = window_obs_->getSize();
+    unsigned int scale = std::max(1u, std::min(window_size.x / logical_size.x, window_size.y / logical_size.y));
+    sf::Vector2f scaled_size = static_cast<sf::Vector2f>(logical_size * scale);
+    sf::Vector2f window_size_f = static_cast<sf::Vector2f>(window_size);
+    sf::Vector2f offset = {std::floor((window_size_f.x - scaled_size.x) / 2.f), std::floor((window_size_f.y - scaled_size.y) / 2.f)};
+
+    sf::Sprite screen(render_texture_->getTexture());
+    screen.setPosition(offset);
+    screen.setScale({static_cast<float>(scale), static_cast<float>(scale)});
+
+    // 用窗口像素坐标绘制，之后恢复原视图，并把视口设置为实际画面区域（鼠标坐标换算需要）
+    sf::View view = window_obs_->getView();
+    window_obs_->setView(sf::View(sf::FloatRect({0.f, 0.f}, window_size_f)));
+    window_obs_->draw(screen);
+    view.setViewport(sf::FloatRect(offset.componentWiseDiv(window_size_f), scaled_size.componentWiseDiv(window_size_f)));
+    window_obs_->setView(view);
+}
+
+void Renderer::push_sprite(const sf::View& view, const sf::Sprite& sprite) {
+    const sf::Texture* texture = &sprite.getTexture();
+    if (texture != batch_texture_obs_ || &view != batch_view_obs_) {
+        flush_batch();
+        batch_texture_obs_ = texture;
+        batch_view_obs_ = &view;
+    }
+    commands_.push_back({sprite.getTransform(), sprite.getTextureRect(), sprite.getColor()});
+}
+
+void Renderer::flush_batch() {
+    if (commands_.empty()) return;
+
+    build_sprite_vertices(commands_, vertices_, thread_pool_obs_);
+
+    sf::RenderStates states;
+    states.texture = batch_texture_obs_;
+    target_obs_->setView(*batch_view_obs_);
+    target_obs_->draw(vertices_.data(), vertices_.size(), sf::PrimitiveType::Triangles, states);
+
+    commands_.clear();
+    batch_texture_obs_ = nullptr;
+    batch_view_obs_ = nullptr;
+}
+
 void Renderer::draw_sprite(const Camera& camera, sf::Sprite& sprite) {
-    window_obs_->setView(camera.get_world_view());
-    window_obs_->draw(sprite);
+    push_sprite(camera.get_world_view(), sprite);
 }
 
 void Renderer::draw_parallax(
@@ -71,11 +148,9 @@ void Renderer::draw_parallax(
     sf::Vector2f view_min = view_center - view_size / 2.f;
     sf::Vector2f view_max = view_center + view_size / 2.f;
 
-    window_obs_->setView(view);
-
     if (!repeat.x && !repeat.y) {
         sprite.setPosition(layer_world_pos);
-        window_obs_->draw(sprite);
+        push_sprite(view, sprite);
         return;
     }
 
@@ -97,14 +172,13 @@ void Renderer::draw_parallax(
     for (float y = start_y; y < end_y; y += tile_size.y) {
         for (float x = start_x; x < end_x; x += tile_size.x) {
             sprite.setPosition({x, y});
-            window_obs_->draw(sprite);
+            push_sprite(view, sprite);
         }
     }
 }
 
 void Renderer::draw_ui_sprite(const Camera& camera, sf::Sprite& sprite) {
-    window_obs_->setView(camera.get_ui_view());
-    window_obs_->draw(sprite);
+    push_sprite(camera.get_ui_view(), sprite);
 }
 
 void Renderer::draw_text(const Camera& camera
@@ -113,7 +187,8 @@ void Renderer::draw_text(const Camera& camera
                        , unsigned int font_size
                        , sf::Vector2f position
                        , sf::Color font_color) {
-    window_obs_->setView(camera.get_world_view());
+    flush_batch();
+    target_obs_->setView(camera.get_world_view());
 
     auto font = resourec_manager_obs_->get_font(font_id);
     if (!font) {
@@ -130,8 +205,8 @@ void Renderer::draw_text(const Camera& camera
     shadow.setPosition(text.getPosition() + sf::Vector2f{2.f, 2.f});
     shadow.setFillColor(sf::Color::Black);
 
-    window_obs_->draw(shadow);
-    window_obs_->draw(text);
+    target_obs_->draw(shadow);
+    target_obs_->draw(text);
 }
 
 void Renderer::draw_ui_text(const Camera& camera
@@ -140,7 +215,8 @@ void Renderer::draw_ui_text(const Camera& camera
                           , unsigned int font_size
                           , sf::Vector2f position
                           , sf::Color font_color) {
-    window_obs_->setView(camera.get_ui_view());
+    flush_batch();
+    target_obs_->setView(camera.get_ui_view());
 
     auto font = resourec_manager_obs_->get_font(font_id);
     if (!font) {
@@ -157,16 +233,17 @@ void Renderer::draw_ui_text(const Camera& camera
     shadow.setPosition(text.getPosition() + sf::Vector2f{2.f, 2.f});
     shadow.setFillColor(sf::Color::Black);
 
-    window_obs_->draw(shadow);
-    window_obs_->draw(text);
+    target_obs_->draw(shadow);
+    target_obs_->draw(text);
 }
 
 void Renderer::draw_ui_filled_rect(const Camera& camera, const sf::FloatRect& rect, sf::Color color) {
-    window_obs_->setView(camera.get_ui_view());
+    flush_batch();
+    target_obs_->setView(camera.get_ui_view());
     sf::RectangleShape shape;
     shape.setPosition({rect.position.x, rect.position.y});
     shape.setSize({rect.size.x, rect.size.y});
     shape.setFillColor(color);
-    window_obs_->draw(shape);
+    target_obs_->draw(shape);
 }
 } // namespace engine::render
\ No newline at end of file
@@ -0,0 +1,44 @@
+#include "sprite_batch.hpp"
+#include "thread_pool.hpp"
+#include <cmath>
+
+namespace engine::render {
+namespace {
+constexpr size_t PARALLEL_CHUNK_SIZE = 256;         ///< @brief 每个并行任务最少处理的精灵数
+} // namespace
+
+void build_sprite_vertices(std::span<const SpriteCommand> commands, std::vector<sf::Vertex>& vertices, engine::core::ThreadPool* thread_pool) {
+    size_t count = commands.size();
+    vertices.resize(count * SPRITE_BATCH_VERTICES_PER_SPRITE);
+
+    auto build_range = [commands, out = vertices.data()](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            build_sprite_quad(commands[i], out + i * SPRITE_BATCH_VERTICES_PER_SPRITE);
+        }
+    };
+    if (thread_pool && count >= SPRITE_BATCH_PARALLEL_THRESHOLD) {
+        thread_pool->parallel_for(count, PARALLEL_CHUNK_SIZE, build_range);
+    } else {
+        build_range(0, count);
+    }
+}
+
+void build_sprite_quad(const SpriteCommand& command, sf::Vertex* out) {
+    // 与 sf::Sprite 的顶点布局一致：局部坐标为源矩形的绝对尺寸，纹理坐标（像素）保留宽高符号以支持翻转
+    sf::Vector2f tex_pos = sf::Vector2f(command.texture_rect.position);
+    sf::Vector2f tex_size = sf::Vector2f(command.texture_rect.size);
+    sf::Vector2f abs_size = {std::abs(tex_size.x), std::abs(tex_size.y)};
+
+    sf::Vertex top_left{command.transform.transformPoint({0.f, 0.f}), command.color, tex_pos};
+    sf::Vertex bottom_left{command.transform.transformPoint({0.f, abs_size.y}), command.color, tex_pos + sf::Vector2f{0.f, tex_size.y}};
+    sf::Vertex top_right{command.transform.transformPoint({abs_size.x, 0.f}), command.color, tex_pos + sf::Vector2f{tex_size.x, 0.f}};
+    sf::Vertex bottom_right{command.transform.transformPoint(abs_size), command.color, tex_pos + tex_size};
+
+    out[0] = top_left;
+    out[1] = bottom_left;
+    out[2] = top_right;
+    out[3] = top_right;
+    out[4] = bottom_left;
+    out[5] = bottom_right;
+}
+} // namespace engine::render
@@ -0,0 +1,47 @@
+#include "animation_library.hpp"
+#include "animation.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace engine::resource {
+namespace {
+/// @brief 两个片段的名称、循环方式与帧序列是否完全相同
+bool same_clip(const engine::render::Animation& a, const engine::render::Animation& b) {
+    return a.get_name() == b.get_name() && a.is_looping() == b.is_looping()
+        && std::ranges::equal(a.get_frames(), b.get_frames(), [](const auto& lhs, const auto& rhs) {
+               return lhs.source_rect == rhs.source_rect && lhs.duration == rhs.duration;
+           });
+}
+} // namespace
+
+AnimationLibrary::AnimationLibrary() = default;
+
+AnimationLibrary::~AnimationLibrary() = default;
+
+const engine::render::Animation* AnimationLibrary::add(std::string_view key, std::unique_ptr<engine::render::Animation> clip) {
+    if (!clip) return nullptr;
+    auto it = clips_.find(key);
+    if (it == clips_.end()) it = clips_.emplace(std::string(key), std::vector<std::unique_ptr<const engine::render::Animation>>{}).first;
+
+    auto& clips = it->second;
+    // 从后往前找，最近登记的版本最可能相同
+    for (auto existing = clips.rbegin(); existing != clips.rend(); ++existing) {
+        if ((*existing)->get_name() != clip->get_name()) continue;
+        if (same_clip(**existing, *clip)) return existing->get();
+        break;      // 同名但内容不同：登记为新版本
+    }
+    clips.push_back(std::move(clip));
+    ++clip_count_;
+    spdlog::debug("AnimationLibrary: 登记动画 '{}' ({})", clips.back()->get_name(), key);
+    return clips.back().get();
+}
+
+const engine::render::Animation* AnimationLibrary::find(std::string_view key, std::string_view name) const {
+    auto it = clips_.find(key);
+    if (it == clips_.end()) return nullptr;
+    auto& clips = it->second;
+    auto found = std::ranges::find_if(clips.rbegin(), clips.rend(), [name](const auto& clip) { return clip->get_name() == name; });
+    return found != clips.rend() ? found->get() : nullptr;
+}
+
+} // namespace engine::resource
@@ -0,0 +1,243 @@
+#include "asset_archive.hpp"
+#include "lz4.hpp"
+#include <spdlog/spdlog.h>
+#include <cstring>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace engine::resource {
+namespace {
+template<typename T>
+T read_value(const std::byte* ptr) {
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    return value;
+}
+} // namespace
+
+// --- AssetData ---
+
+AssetData AssetData::view(std::span<const std::byte> bytes) {
+    AssetData data;
+    data.bytes_ = bytes;
+    return data;
+}
+
+AssetData AssetData::own(std::vector<std::byte> bytes) {
+    AssetData data;
+    data.owned_ = std::move(bytes);
+    data.bytes_ = data.owned_;     // vector 移动时缓冲区地址不变，span 保持有效
+    return data;
+}
+
+std::optional<AssetData> AssetData::map_file(const std::filesystem::path& path) {
+    AssetData data;
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return std::nullopt;
+    LARGE_INTEGER size{};
+    GetFileSizeEx(file, &size);
+    if (size.QuadPart == 0) {
+        CloseHandle(file);
+        return data;
+    }
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (mapping) CloseHandle(mapping);      // 视图持有映射对象的引用
+    if (!view) return std::nullopt;
+    data.mapping_ = std::shared_ptr<const void>(view, [](const void* ptr) { UnmapViewOfFile(ptr); });
+    data.bytes_ = {static_cast<const std::byte*>(view), static_cast<size_t>(size.QuadPart)};
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return std::nullopt;
+    struct stat info{};
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        return std::nullopt;
+    }
+    if (info.st_size == 0) {
+        ::close(fd);
+        return data;
+    }
+    auto size = static_cast<size_t>(info.st_size);
+    void* view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) return std::nullopt;
+    data.mapping_ = std::shared_ptr<const void>(view, [size](const void* ptr) { ::munmap(const_cast<void*>(ptr), size); });
+    data.bytes_ = {static_cast<const std::byte*>(view), size};
+#endif
+    return data;
+}
+
+// --- AssetArchive ---
+
+AssetArchive::~AssetArchive() {
+    close();
+}
+
+bool AssetArchive::open(const std::filesystem::path& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        spdlog::info("未找到资源包 '{}'，将从散文件加载资源", path.string());
+        return false;
+    }
+    LARGE_INTEGER size{};
+    GetFileSizeEx(file, &size);
+    HANDLE mapping = size.QuadPart > 0 ? CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+    CloseHandle(file);      // 映射对象持有文件引用
+    if (!mapping) {
+        spdlog::error("映射资源包 '{}' 失败", path.string());
+        return false;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        spdlog::error("映射资源包 '{}' 失败", path.string());
+        return false;
+    }
+    mapping_handle_ = mapping;
+    mapped_ = static_cast<const std::byte*>(view);
+    mapped_size_ = static_cast<size_t>(size.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        spdlog::info("未找到资源包 '{}'，将从散文件加载资源", path.string());
+        return false;
+    }
+    struct stat info{};
+    void* view = MAP_FAILED;
+    if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+        view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);            // 映射建立后即可关闭文件描述符
+    if (view == MAP_FAILED) {
+        spdlog::error("映射资源包 '{}' 失败", path.string());
+        return false;
+    }
+    mapped_ = static_cast<const std::byte*>(view);
+    mapped_size_ = static_cast<size_t>(info.st_size);
+#endif
+
+    if (!parse_index()) {
+        spdlog::error("资源包 '{}' 格式错误，已忽略", path.string());
+        close();
+        return false;
+    }
+    spdlog::info("已挂载资源包 '{}'，共 {} 个资源", path.string(), entries_.size());
+    return true;
+}
+
+void AssetArchive::close() {
+    entries_.clear();
+    if (!mapped_) return;
+#ifdef _WIN32
+    UnmapViewOfFile(mapped_);
+    CloseHandle(mapping_handle_);
+    mapping_handle_ = nullptr;
+#else
+    ::munmap(const_cast<std::byte*>(mapped_), mapped_size_);
+#endif
+    mapped_ = nullptr;
+    mapped_size_ = 0;
+}
+
+bool AssetArchive::parse_index() {
+    using namespace archive_format;
+    if (mapped_size_ < HEADER_SIZE || std::memcmp(mapped_, MAGIC.data(), MAGIC.size()) != 0) return false;
+    if (auto version = read_value<uint32_t>(mapped_ + 4); version != VERSION) {
+        spdlog::error("资源包版本 {} 不受支持（需要 {}）", version, VERSION);
+        return false;
+    }
+    auto entry_count = read_value<uint32_t>(mapped_ + 8);
+
+    size_t pos = HEADER_SIZE;
+    entries_.reserve(entry_count);
+    for (uint32_t i = 0; i < entry_count; ++i) {
+        if (mapped_size_ - pos < ENTRY_FIXED_SIZE) return false;
+        auto path_length = read_value<uint16_t>(mapped_ + pos);
+        pos += 2;
+        if (mapped_size_ - pos < path_length + ENTRY_FIXED_SIZE - 2) return false;
+        std::string path(reinterpret_cast<const char*>(mapped_ + pos), path_length);
+        pos += path_length;
+
+        Entry entry;
+        auto compression = read_value<uint8_t>(mapped_ + pos);
+        if (compression > static_cast<uint8_t>(Compression::LZ4)) return false;
+        entry.compression = static_cast<Compression>(compression);
+        entry.offset = read_value<uint64_t>(mapped_ + pos + 1);
+        entry.stored_size = read_value<uint64_t>(mapped_ + pos + 9);
+        entry.original_size = read_value<uint64_t>(mapped_ + pos + 17);
+        pos += ENTRY_FIXED_SIZE - 2;
+
+        if (entry.offset > mapped_size_ || entry.stored_size > mapped_size_ - entry.offset) return false;
+        if (entry.compression == Compression::None && entry.stored_size != entry.original_size) return false;
+        // load() 按 original_size 分配解压缓冲区：损坏或截断的索引不能导致超大分配
+        if (entry.original_size > MAX_ORIGINAL_SIZE || entry.original_size > entry.stored_size * LZ4_MAX_EXPANSION) {
+            spdlog::error("资源包中 '{}' 的原始大小 {} 字节不合理（存储 {} 字节），索引可能已损坏", path, entry.original_size, entry.stored_size);
+            return false;
+        }
+        entries_.insert_or_assign(std::move(path), entry);
+    }
+    return true;
+}
+
+const AssetArchive::Entry* AssetArchive::find_entry(std::string_view path) const {
+    if (entries_.empty()) return nullptr;
+    // 常见情况下调用方传入的就是规范路径，先直接查找，避免构造 filesystem::path
+    if (auto it = entries_.find(path); it != entries_.end()) return &it->second;
+    if (auto it = entries_.find(normalize_path(path)); it != entries_.end()) return &it->second;
+    return nullptr;
+}
+
+bool AssetArchive::contains(std::string_view path) const {
+    return find_entry(path) != nullptr;
+}
+
+std::optional<uint64_t> AssetArchive::find_size(std::string_view path) const {
+    const Entry* entry = find_entry(path);
+    if (!entry) return std::nullopt;
+    return entry->original_size;
+}
+
+std::optional<AssetData> AssetArchive::load(std::string_view path) const {
+    const Entry* entry = find_entry(path);
+    if (!entry) return std::nullopt;
+
+    std::span<const std::byte> stored{mapped_ + entry->offset, static_cast<size_t>(entry->stored_size)};
+    if (entry->compression == archive_format::Compression::None) {
+        return AssetData::view(stored);
+    }
+
+    std::vector<std::byte> buffer(static_cast<size_t>(entry->original_size));
+    if (!engine::utils::lz4_decompress(stored, buffer)) {
+        spdlog::error("资源包中的 '{}' 解压失败，数据可能已损坏", path);
+        return std::nullopt;
+    }
+    return AssetData::own(std::move(buffer));
+}
+
+std::string AssetArchive::normalize_path(std::string_view path) {
+    std::filesystem::path result{path};
+    if (result.is_absolute()) {
+        std::error_code ec;
+        auto base = std::filesystem::current_path(ec);
+        if (!ec) result = result.lexically_relative(base);
+    }
+    return result.lexically_normal().generic_string();
+}
+
+} // namespace engine::resource
@@ -0,0 +1,148 @@
+#include "asset_watcher.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstdint>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace engine::resource {
+
+AssetWatcher::~AssetWatcher() {
+    stop();
+}
+
+std::vector<std::string> AssetWatcher::consume_changes() {
+    std::vector<std::string> changes;
+    {
+        std::lock_guard lock(mutex_);
+        changes.swap(changes_);
+    }
+    // 一次保存常常产生多个事件，合并为一次
+    std::ranges::sort(changes);
+    auto duplicates = std::ranges::unique(changes);
+    changes.erase(duplicates.begin(), duplicates.end());
+    return changes;
+}
+
+#ifdef __linux__
+
+bool AssetWatcher::start(const std::filesystem::path& root) {
+    stop();
+    inotify_fd_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    wake_fd_ = ::eventfd(0, EFD_CLOEXEC);
+    if (inotify_fd_ < 0 || wake_fd_ < 0) {
+        spdlog::error("创建 inotify 实例失败，资源热重载不可用");
+        stop();
+        return false;
+    }
+
+    add_watch_recursive(root);
+    if (watch_dirs_.empty()) {
+        spdlog::error("无法监视目录 '{}'，资源热重载不可用", root.string());
+        stop();
+        return false;
+    }
+
+    thread_ = std::thread([this]() { watch_loop(); });
+    spdlog::info("资源热重载已启用，监视 {} 个目录", watch_dirs_.size());
+    return true;
+}
+
+void AssetWatcher::stop() {
+    if (thread_.joinable()) {
+        uint64_t signal = 1;
+        [[maybe_unused]] auto written = ::write(wake_fd_, &signal, sizeof(signal));
+        thread_.join();
+    }
+    if (inotify_fd_ >= 0) ::close(inotify_fd_);     // 关闭实例会同时移除所有监视
+    if (wake_fd_ >= 0) ::close(wake_fd_);
+    inotify_fd_ = -1;
+    wake_fd_ = -1;
+    watch_dirs_.clear();
+}
+
+void AssetWatcher::add_watch_recursive(const std::filesystem::path& dir) {
+    constexpr uint32_t MASK = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+    int wd = ::inotify_add_watch(inotify_fd_, dir.c_str(), MASK);
+    if (wd < 0) {
+        spdlog::warn("无法监视目录 '{}'", dir.string());
+        return;
+    }
+    watch_dirs_[wd] = dir.generic_string();
+
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+        if (entry.is_directory(ec)) add_watch_recursive(entry.path());
+    }
+}
+
+void AssetWatcher::watch_loop() {
+    // inotify_event 后跟变长文件名，缓冲区按事件结构体对齐
+    alignas(inotify_event) char buffer[4096];
+    while (true) {
+        pollfd fds[2] = {{inotify_fd_, POLLIN, 0}, {wake_fd_, POLLIN, 0}};
+        if (::poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) continue;
+            spdlog::error("等待 inotify 事件失败，资源热重载已停止");
+            return;
+        }
+        if (fds[1].revents & POLLIN) return;        // 收到停止信号
+        if (!(fds[0].revents & POLLIN)) continue;
+
+        ssize_t length = ::read(inotify_fd_, buffer, sizeof(buffer));
+        if (length <= 0) continue;
+
+        std::vector<std::string> changed;
+        for (ssize_t offset = 0; offset < length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                spdlog::warn("inotify 事件队列溢出，部分资源变更可能被忽略");
+                continue;
+            }
+            auto dir = watch_dirs_.find(event->wd);
+            if (dir == watch_dirs_.end() || event->len == 0) continue;
+
+            std::string path = dir->second + "/" + event->name;
+            if (event->mask & IN_ISDIR) {
+                if (event->mask & (IN_CREATE | IN_MOVED_TO)) add_watch_recursive(path);
+                continue;
+            }
+            if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {     // 单独的 IN_CREATE 说明文件还没写完
+                changed.push_back(std::move(path));
+            }
+        }
+
+        if (!changed.empty()) {
+            std::lock_guard lock(mutex_);
+            changes_.insert(changes_.end(), std::make_move_iterator(changed.begin()), std::make_move_iterator(changed.end()));
+        }
+    }
+}
+
+#else
+
+bool AssetWatcher::start(const std::filesystem::path& root) {
+    spdlog::warn("当前平台不支持资源热重载（需要 inotify），忽略对 '{}' 的监视", root.string());
+    return false;
+}
+
+void AssetWatcher::stop() {
+}
+
+void AssetWatcher::add_watch_recursive(const std::filesystem::path&) {
+}
+
+void AssetWatcher::watch_loop() {
+}
+
+#endif
+
+} // namespace engine::resource
@@ -1,126 +1,685 @@
 #include "resource_manager.hpp"
+#include "thread_pool.hpp"
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
 #include <stdexcept>
+#include <thread>
 
 namespace engine::resource {
+namespace {
+/**
+ * @brief 在线程池上（无线程池时在调用线程）创建并加载一个资源对象
+ * @param load 形如 bool(T&, const std::string&, AssetData&) 的加载函数，只能访问传入的对象与只读的资源包；
+ *             以内存方式打开、需要数据一直有效的资源把数据移入第三个参数
+ */
+template<typename Result, typename Load>
+std::future<Result> decode_async(engine::core::ThreadPool* thread_pool, std::string path, Load load) {
+    using T = typename decltype(Result::resource)::element_type;
+    auto task = [path = std::move(path), load]() -> Result {
+        Result result{std::make_unique<T>(), {}};
+        if (!load(*result.resource, path, result.memory)) result.resource.reset();
+        return result;
+    };
+    if (thread_pool) return thread_pool->submit(std::move(task));
+
+    std::promise<Result> promise;
+    promise.set_value(task());
+    return promise.get_future();
+}
+
+template<typename T>
+std::shared_future<T*> make_ready_future(T* value) {
+    std::promise<T*> promise;
+    promise.set_value(value);
+    return promise.get_future().share();
+}
+
+template<typename Future>
+bool is_ready(const Future& future) {
+    return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+/**
+ * @brief 同步接口使用：阻塞等待指定资源解码完成并立即收尾
+ */
+template<typename Pending, typename Finalize>
+void finalize_now(std::string_view file, std::vector<Pending>& pending, Finalize finalize) {
+    auto it = std::ranges::find(pending, file, &Pending::key);
+    if (it == pending.end()) return;
+    it->decoded.wait();
+    finalize(*it);
+    pending.erase(it);
+}
+
+/**
+ * @brief 收尾所有已解码完成的资源（不受时间预算限制）
+ */
+template<typename Pending, typename Finalize>
+void finalize_ready(std::vector<Pending>& pending, Finalize finalize) {
+    std::erase_if(pending, [&finalize](Pending& entry) {
+        if (!is_ready(entry.decoded)) return false;
+        finalize(entry);
+        return true;
+    });
+}
+
+// --- 资源占用字节数估算 ---
+size_t texture_bytes(const sf::Texture& texture) {
+    auto size = texture.getSize();
+    return static_cast<size_t>(size.x) * size.y * 4;    // RGBA8
+}
+
+size_t sound_bytes(const sf::SoundBuffer& buffer) {
+    return static_cast<size_t>(buffer.getSampleCount()) * sizeof(std::int16_t);
+}
+
+constexpr uint32_t NO_SLOT = std::numeric_limits<uint32_t>::max();     ///< @brief LRU 查找时表示“没有可淘汰的槽”
+
+size_t file_bytes(const std::string& path) {
+    std::error_code error;
+    auto size = std::filesystem::file_size(path, error);
+    return error ? 0 : static_cast<size_t>(size);
+}
+
+/// @brief 读取整个散文件，失败返回 std::nullopt
+std::optional<AssetData> read_loose_file(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) return std::nullopt;
+    std::vector<std::byte> buffer(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()))) return std::nullopt;
+    return AssetData::own(std::move(buffer));
+}
+} // namespace
+
+ResourceManager::ResourceManager(engine::core::ThreadPool* thread_pool)
+    : thread_pool_obs_{thread_pool} {
+}
+
+ResourceManager::~ResourceManager() {
+    // 线程池比资源管理器活得久，排队或执行中的解码任务引用着 archive_，必须先等它们结束
+    if (get_pending_count() > 0) {
+        spdlog::debug("ResourceManager 销毁前等待 {} 个异步解码结束", get_pending_count());
+        wait_pending_decodes();
+    }
+}
+
+void ResourceManager::wait_pending_decodes() const {
+    auto wait_all = [](const auto& pending) {
+        for (const auto& entry : pending) {
+            if (entry.decoded.valid()) entry.decoded.wait();
+        }
+    };
+    wait_all(pending_textures_);
+    wait_all(pending_sounds_);
+    wait_all(pending_fonts_);
+}
+
+// ---------------- Archive ----------------
+bool ResourceManager::mount_archive(const std::filesystem::path& path) {
+    if (get_pending_count() > 0) {
+        spdlog::warn("仍有异步加载未完成，等待解码结束后再挂载资源包 '{}'", path.string());
+        wait_pending_decodes();     // 解码任务正在读取当前资源包，不能在其下方替换
+    }
+    return archive_.open(path);
+}
+
+std::optional<AssetData> ResourceManager::read_asset(std::string_view file) const {
+    if (auto data = archive_.load(file)) return data;
+    return read_loose_file(std::string(file));
+}
+
+// ---------------- Storage ----------------
+template<typename T>
+T* ResourceManager::find_resource(Storage<T>& storage, std::string_view key) {
+    auto it = storage.indices.find(key);
+    if (it == storage.indices.end() || !storage.slots[it->second].resource) return nullptr;
+    touch(storage, it->second, active_scope_);
+    return storage.slots[it->second].resource.get();
+}
+
+template<typename T>
+typename ResourceManager::Storage<T>::Slot* ResourceManager::find_slot(Storage<T>& storage, ResourceHandle<T> handle) {
+    if (!handle.is_valid() || handle.get_index() >= storage.slots.size()) return nullptr;
+    auto& slot = storage.slots[handle.get_index()];
+    if (slot.resource) touch(storage, handle.get_index(), active_scope_);
+    return &slot;
+}
+
+template<typename T>
+uint32_t ResourceManager::acquire_slot(Storage<T>& storage, std::string_view key) {
+    if (auto it = storage.indices.find(key); it != storage.indices.end()) return it->second;
+    auto index = static_cast<uint32_t>(storage.slots.size());
+    storage.slots.emplace_back(std::string(key));
+    storage.indices.emplace(std::string(key), index);
+    return index;
+}
+
+template<typename T>
+T* ResourceManager::store_resource(Storage<T>& storage, std::string_view key, std::unique_ptr<T> resource, size_t bytes, uint32_t scope_id, AssetData memory) {
+    auto index = acquire_slot(storage, key);
+    auto& slot = storage.slots[index];
+    storage.resident_bytes -= slot.bytes;
+    slot.resource = std::move(resource);
+    slot.memory = std::move(memory);
+    slot.bytes = bytes;
+    storage.resident_bytes += bytes;
+    touch(storage, index, scope_id);
+    return slot.resource.get();
+}
+
+template<typename T>
+void ResourceManager::touch(Storage<T>& storage, uint32_t index, uint32_t scope_id) {
+    auto& slot = storage.slots[index];
+    slot.last_used = ++access_clock_;
+    if (storage.type == ResourceType::Music || scope_id == 0 || slot.recorded_scope == scope_id) return;
+
+    auto scope = scopes_.find(scope_id);
+    if (scope == scopes_.end()) return;     // 作用域已释放
+    scope->second.emplace_back(storage.type, index);
+    slot.recorded_scope = scope_id;
+    ++slot.ref_count;
+}
+
+template<typename T>
+void ResourceManager::release_slot(Storage<T>& storage, uint32_t index) {
+    auto& slot = storage.slots[index];
+    if (!slot.resource) return;
+    storage.resident_bytes -= slot.bytes;
+    slot.bytes = 0;
+    slot.resource.reset();
+    slot.memory = {};       // 必须在资源之后释放
+    slot.recorded_scope = 0;
+    spdlog::debug("Unloaded '{}'", slot.key);
+}
+
+template<typename T>
+void ResourceManager::release_reference(Storage<T>& storage, uint32_t index) {
+    auto& slot = storage.slots[index];
+    if (slot.ref_count == 0) return;
+    if (--slot.ref_count == 0 && memory_budget_ == 0) {
+        release_slot(storage, index);
+    }
+}
+
+template<typename Pending, typename T, typename Load>
+std::shared_future<T*> ResourceManager::request_async(std::string_view file, Storage<T>& storage, std::vector<Pending>& pending, Load load) {
+    using Result = decltype(std::declval<Pending&>().decoded.get());
+    if (auto* resource = find_resource(storage, file)) return make_ready_future(resource);
+    if (auto it = std::ranges::find(pending, file, &Pending::key); it != pending.end()) return it->result;
+
+    auto& entry = pending.emplace_back();
+    entry.key = std::string(file);
+    entry.scope_id = active_scope_;
+    entry.decoded = decode_async<Result>(thread_pool_obs_, entry.key, load);
+    entry.result = entry.promise.get_future().share();
+    return entry.result;
+}
+
 // ---------------- Texture ----------------
 sf::Texture* ResourceManager::load_texture(std::string_view file) {
-    auto key = std::string(file);
-    if (textures_.contains(key)) return textures_[key].get();
+    auto result = load_texture_async(file);
+    finalize_now(file, pending_textures_, [this](PendingTexture& pending) { finalize_texture(pending); });
+    return result.get();
+}
 
-    auto texture = std::make_unique<sf::Texture>();
-    if (!texture->loadFromFile(key)) {
-        spdlog::error("Failed to load Texture '{}'", key);
-        return nullptr;
+std::shared_future<sf::Texture*> ResourceManager::load_texture_async(std::string_view file) {
+    // 工作线程只解码为 sf::Image，显存上传留给主线程
+    return request_async(file, textures_, pending_textures_, [&archive = archive_](sf::Image& image, const std::string& path, AssetData&) {
+        if (auto data = archive.load(path)) return image.loadFromMemory(data->data(), data->size());
+        return image.loadFromFile(path);
+    });
+}
+
+void ResourceManager::finalize_texture(PendingTexture& pending) {
+    auto image = pending.decoded.get().resource;
+    sf::Texture* result = nullptr;
+    if (!image) {
+        spdlog::error("Failed to load Texture '{}'", pending.key);
+    } else {
+        auto texture = std::make_unique<sf::Texture>();
+        if (!texture->loadFromImage(*image)) {
+            spdlog::error("Failed to upload Texture '{}'", pending.key);
+        } else {
+            spdlog::debug("Loaded Texture '{}'", pending.key);
+            auto bytes = texture_bytes(*texture);
+            result = store_resource(textures_, pending.key, std::move(texture), bytes, pending.scope_id);
+            enforce_memory_budget();
+        }
     }
-    spdlog::debug("Loaded Texture '{}'", key);
-    return textures_.emplace(key, std::move(texture)).first->second.get();
+    pending.promise.set_value(result);
 }
 
 sf::Texture* ResourceManager::get_texture(std::string_view file) {
-    auto key = std::string(file);
-    if (textures_.contains(key)) return textures_[key].get();
-    spdlog::warn("Texture '{}' not found, loading...", key);
-    return load_texture(key);
+    if (auto* resource = find_resource(textures_, file)) return resource;
+    spdlog::warn("Texture '{}' not found, loading...", file);
+    return load_texture(file);
+}
+
+sf::Texture* ResourceManager::get_texture(TextureHandle handle) {
+    auto* slot = find_slot(textures_, handle);
+    if (!slot) return nullptr;
+    if (slot->resource) return slot->resource.get();
+    spdlog::warn("Texture '{}' not found, loading...", slot->key);
+    return load_texture(slot->key);
+}
+
+TextureHandle ResourceManager::get_texture_handle(std::string_view file) {
+    return TextureHandle(acquire_slot(textures_, file));
+}
+
+sf::Texture* ResourceManager::find_texture(std::string_view file) const {
+    auto it = textures_.indices.find(file);
+    return it == textures_.indices.end() ? nullptr : textures_.slots[it->second].resource.get();
 }
 
 void ResourceManager::unload_texture(std::string_view file) {
-    textures_.erase(std::string(file));
-    spdlog::debug("Unloaded Texture '{}'", file);
+    if (auto it = textures_.indices.find(file); it != textures_.indices.end()) {
+        release_slot(textures_, it->second);
+    }
 }
 
 void ResourceManager::clear_textures() {
-    textures_.clear();
+    for (uint32_t i = 0; i < textures_.slots.size(); ++i) {
+        release_slot(textures_, i);
+    }
 }
 
 // ---------------- SoundBuffer ----------------
 sf::SoundBuffer* ResourceManager::load_sound(std::string_view file) {
-    auto key = std::string(file);
-    if (sounds_.contains(key)) return sounds_[key].get();
+    auto result = load_sound_async(file);
+    finalize_now(file, pending_sounds_, [this](PendingSound& pending) { finalize_sound(pending); });
+    return result.get();
+}
 
-    auto buffer = std::make_unique<sf::SoundBuffer>();
-    if (!buffer->loadFromFile(key)) {
-        spdlog::error("Failed to load SoundBuffer '{}'", key);
-        return nullptr;
+std::shared_future<sf::SoundBuffer*> ResourceManager::load_sound_async(std::string_view file) {
+    // SoundBuffer 会把样本解码拷贝到自身，数据块用完即可丢弃
+    return request_async(file, sounds_, pending_sounds_, [&archive = archive_](sf::SoundBuffer& buffer, const std::string& path, AssetData&) {
+        if (auto data = archive.load(path)) return buffer.loadFromMemory(data->data(), data->size());
+        return buffer.loadFromFile(path);
+    });
+}
+
+void ResourceManager::finalize_sound(PendingSound& pending) {
+    auto buffer = pending.decoded.get().resource;
+    sf::SoundBuffer* result = nullptr;
+    if (!buffer) {
+        spdlog::error("Failed to load SoundBuffer '{}'", pending.key);
+    } else {
+        spdlog::debug("Loaded SoundBuffer '{}'", pending.key);
+        auto bytes = sound_bytes(*buffer);
+        result = store_resource(sounds_, pending.key, std::move(buffer), bytes, pending.scope_id);
+        enforce_memory_budget();
     }
-    spdlog::debug("Loaded SoundBuffer '{}'", key);
-    return sounds_.emplace(key, std::move(buffer)).first->second.get();
+    pending.promise.set_value(result);
 }
 
 sf::SoundBuffer* ResourceManager::get_sound(std::string_view file) {
-    auto key = std::string(file);
-    if (sounds_.contains(key)) return sounds_[key].get();
-    spdlog::warn("SoundBuffer '{}' not found, loading...", key);
-    return load_sound(key);
+    if (auto* resource = find_resource(sounds_, file)) return resource;
+    spdlog::warn("SoundBuffer '{}' not found, loading...", file);
+    return load_sound(file);
+}
+
+sf::SoundBuffer* ResourceManager::get_sound(SoundHandle handle) {
+    auto* slot = find_slot(sounds_, handle);
+    if (!slot) return nullptr;
+    if (slot->resource) return slot->resource.get();
+    spdlog::warn("SoundBuffer '{}' not found, loading...", slot->key);
+    return load_sound(slot->key);
+}
+
+SoundHandle ResourceManager::get_sound_handle(std::string_view file) {
+    return SoundHandle(acquire_slot(sounds_, file));
 }
 
 void ResourceManager::unload_sound(std::string_view file) {
-    sounds_.erase(std::string(file));
-    spdlog::debug("Unloaded SoundBuffer '{}'", file);
+    if (auto it = sounds_.indices.find(file); it != sounds_.indices.end()) {
+        release_slot(sounds_, it->second);
+    }
 }
 
 void ResourceManager::clear_sounds() {
-    sounds_.clear();
+    for (uint32_t i = 0; i < sounds_.slots.size(); ++i) {
+        release_slot(sounds_, i);
+    }
 }
 
 // ---------------- Music ----------------
 sf::Music* ResourceManager::load_music(std::string_view file) {
-    auto key = std::string(file);
-    if (musics_.contains(key)) return musics_[key].get();
+    if (auto* music = find_resource(musics_, file)) return music;
 
+    // 音乐播放期间持续从数据源读取，资源包中的数据需随槽一起保留
     auto music = std::make_unique<sf::Music>();
-    if (!music->openFromFile(key)) {
-        spdlog::error("Failed to load Music '{}'", key);
+    auto data = archive_.load(file);
+    bool opened = data ? music->openFromMemory(data->data(), data->size()) : music->openFromFile(std::string(file));
+    if (!opened) {
+        spdlog::error("Failed to load Music '{}'", file);
         return nullptr;
     }
-    spdlog::debug("Loaded Music '{}'", key);
-    return musics_.emplace(key, std::move(music)).first->second.get();
+    spdlog::debug("Loaded Music '{}'", file);
+    return store_resource(musics_, file, std::move(music), 0, active_scope_, data ? std::move(*data) : AssetData{});
+}
+
+std::shared_future<sf::Music*> ResourceManager::load_music_async(std::string_view file) {
+    return make_ready_future(load_music(file));
 }
 
 sf::Music* ResourceManager::get_music(std::string_view file) {
-    auto key = std::string(file);
-    if (musics_.contains(key)) return musics_[key].get();
-    spdlog::warn("Music '{}' not found, loading...", key);
-    return load_music(key);
+    if (auto* resource = find_resource(musics_, file)) return resource;
+    spdlog::warn("Music '{}' not found, loading...", file);
+    return load_music(file);
+}
+
+sf::Music* ResourceManager::get_music(MusicHandle handle) {
+    auto* slot = find_slot(musics_, handle);
+    if (!slot) return nullptr;
+    if (slot->resource) return slot->resource.get();
+    spdlog::warn("Music '{}' not found, loading...", slot->key);
+    return load_music(slot->key);
+}
+
+MusicHandle ResourceManager::get_music_handle(std::string_view file) {
+    return MusicHandle(acquire_slot(musics_, file));
 }
 
 void ResourceManager::unload_music(std::string_view file) {
-    musics_.erase(std::string(file));
-    spdlog::debug("Unloaded music '{}'", file);
+    if (auto it = musics_.indices.find(file); it != musics_.indices.end()) {
+        release_slot(musics_, it->second);
+    }
 }
 
 void ResourceManager::clear_musics() {
-    musics_.clear();
+    for (uint32_t i = 0; i < musics_.slots.size(); ++i) {
+        release_slot(musics_, i);
+    }
 }
 
 // ---------------- Font ----------------
 sf::Font* ResourceManager::load_font(std::string_view file) {
-    auto key = std::string(file);
-    if (fonts_.contains(key)) return fonts_[key].get();
+    auto result = load_font_async(file);
+    finalize_now(file, pending_fonts_, [this](PendingFont& pending) { finalize_font(pending); });
+    return result.get();
+}
 
-    auto font = std::make_unique<sf::Font>();
-    if (!font->openFromFile(key)) {
-        spdlog::error("Failed to load Font '{}'", key);
-        return nullptr;
+std::shared_future<sf::Font*> ResourceManager::load_font_async(std::string_view file) {
+    // 字体按需读取字形，数据需在字体生命周期内保持有效
+    return request_async(file, fonts_, pending_fonts_, [&archive = archive_](sf::Font& font, const std::string& path, AssetData& memory) {
+        if (auto data = archive.load(path)) {
+            memory = std::move(*data);
+            return font.openFromMemory(memory.data(), memory.size());
+        }
+        return font.openFromFile(path);
+    });
+}
+
+void ResourceManager::finalize_font(PendingFont& pending) {
+    auto [font, memory] = pending.decoded.get();
+    sf::Font* result = nullptr;
+    if (!font) {
+        spdlog::error("Failed to load Font '{}'", pending.key);
+    } else {
+        spdlog::debug("Loaded Font '{}'", pending.key);
+        auto bytes = memory.empty() ? file_bytes(pending.key) : memory.size();
+        result = store_resource(fonts_, pending.key, std::move(font), bytes, pending.scope_id, std::move(memory));
     }
-    spdlog::debug("Loaded Font '{}'", key);
-    return fonts_.emplace(key, std::move(font)).first->second.get();
+    pending.promise.set_value(result);
 }
 
 sf::Font* ResourceManager::get_font(std::string_view file) {
-    auto key = std::string(file);
-    if (fonts_.contains(key)) return fonts_[key].get();
-    spdlog::warn("Font '{}' not found, loading...", key);
-    return load_font(key);
+    if (auto* resource = find_resource(fonts_, file)) return resource;
+    spdlog::warn("Font '{}' not found, loading...", file);
+    return load_font(file);
+}
+
+sf::Font* ResourceManager::get_font(FontHandle handle) {
+    auto* slot = find_slot(fonts_, handle);
+    if (!slot) return nullptr;
+    if (slot->resource) return slot->resource.get();
+    spdlog::warn("Font '{}' not found, loading...", slot->key);
+    return load_font(slot->key);
+}
+
+FontHandle ResourceManager::get_font_handle(std::string_view file) {
+    return FontHandle(acquire_slot(fonts_, file));
 }
 
 void ResourceManager::unload_font(std::string_view file) {
-    fonts_.erase(std::string(file));
-    spdlog::debug("Unloaded Font '{}'", file);
+    if (auto it = fonts_.indices.find(file); it != fonts_.indices.end()) {
+        release_slot(fonts_, it->second);
+    }
 }
 
 void ResourceManager::clear_fonts() {
-    fonts_.clear();
+    for (uint32_t i = 0; i < fonts_.slots.size(); ++i) {
+        release_slot(fonts_, i);
+    }
+}
+
+// ---------------- Async ----------------
+void ResourceManager::process_pending_loads(sf::Time texture_upload_budget) {
+    finalize_ready(pending_sounds_, [this](PendingSound& pending) { finalize_sound(pending); });
+    finalize_ready(pending_fonts_, [this](PendingFont& pending) { finalize_font(pending); });
+
+    // 纹理上传需要占用主线程的 GL 上下文，按提交顺序在预算内进行；至少处理一张，避免大纹理永远饿死
+    sf::Clock clock;
+    bool uploaded_any = false;
+    for (auto it = pending_textures_.begin(); it != pending_textures_.end();) {
+        if (uploaded_any && clock.getElapsedTime() >= texture_upload_budget) break;
+        if (!is_ready(it->decoded)) {
+            ++it;
+            continue;
+        }
+        finalize_texture(*it);
+        it = pending_textures_.erase(it);
+        uploaded_any = true;
+    }
+}
+
+size_t ResourceManager::get_pending_count() const {
+    return pending_textures_.size() + pending_sounds_.size() + pending_fonts_.size();
+}
+
+bool ResourceManager::preload(const ResourceManifest& manifest
+                            , const std::function<void(size_t loaded, size_t total)>& on_progress
+                            , bool parallel) {
+    const size_t total = manifest.size();
+    size_t loaded = 0;
+    size_t failed = 0;
+    auto report = [&]() { if (on_progress) on_progress(loaded, total); };
+    report();
+
+    // 音乐只是打开数据源，直接在主线程完成
+    for (const auto& path : manifest.musics) {
+        if (!load_music(path)) ++failed;
+        ++loaded;
+    }
+    if (!manifest.musics.empty()) report();
+
+    if (!parallel || !thread_pool_obs_) {
+        auto load_each = [&](const std::vector<std::string>& paths, auto load) {
+            for (const auto& path : paths) {
+                if (!(this->*load)(path)) ++failed;
+                ++loaded;
+                report();
+            }
+        };
+        load_each(manifest.textures, &ResourceManager::load_texture);
+        load_each(manifest.sounds, &ResourceManager::load_sound);
+        load_each(manifest.fonts, &ResourceManager::load_font);
+        spdlog::info("预加载完成：{} 个资源，失败 {} 个", total, failed);
+        return failed == 0;
+    }
+
+    // 先全部投递，让线程池同时解码（音乐已在上面打开，这里的清单不再包含音乐）
+    auto async_manifest = manifest;
+    async_manifest.musics.clear();
+    auto batch = begin_preload(async_manifest);
+
+    // 收尾循环：加载阶段不受每帧上传预算限制，但仍按批次返回以便回调刷新加载界面
+    constexpr auto UPLOAD_SLICE = sf::milliseconds(16);
+    const size_t music_loaded = loaded;
+    while (true) {
+        poll_preload(batch, UPLOAD_SLICE);
+        if (music_loaded + batch.loaded != loaded) {
+            loaded = music_loaded + batch.loaded;
+            report();
+        }
+        if (batch.is_done()) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));     // 等待工作线程解码
+    }
+    failed += batch.failed;
+    spdlog::info("预加载完成：{} 个资源，失败 {} 个", total, failed);
+    return failed == 0;
+}
+
+PreloadBatch ResourceManager::begin_preload(const ResourceManifest& manifest) {
+    PreloadBatch batch;
+    batch.total = manifest.size();
+
+    // 音乐只是打开数据源，直接在主线程完成
+    for (const auto& path : manifest.musics) {
+        if (!load_music(path)) ++batch.music_failed;
+    }
+
+    batch.textures.reserve(manifest.textures.size());
+    batch.sounds.reserve(manifest.sounds.size());
+    batch.fonts.reserve(manifest.fonts.size());
+    for (const auto& path : manifest.textures) batch.textures.push_back(load_texture_async(path));
+    for (const auto& path : manifest.sounds) batch.sounds.push_back(load_sound_async(path));
+    for (const auto& path : manifest.fonts) batch.fonts.push_back(load_font_async(path));
+
+    batch.loaded = manifest.musics.size();
+    batch.failed = batch.music_failed;
+    return batch;
+}
+
+void ResourceManager::poll_preload(PreloadBatch& batch, sf::Time texture_upload_budget) {
+    if (batch.is_done()) return;
+    process_pending_loads(texture_upload_budget);
+
+    size_t ready = 0;
+    size_t failed = 0;
+    auto count_ready = [&ready, &failed](const auto& futures) {
+        for (const auto& future : futures) {
+            if (!is_ready(future)) continue;
+            ++ready;
+            if (!future.get()) ++failed;
+        }
+    };
+    count_ready(batch.textures);
+    count_ready(batch.sounds);
+    count_ready(batch.fonts);
+    batch.loaded = batch.total - batch.textures.size() - batch.sounds.size() - batch.fonts.size() + ready;
+    batch.failed = batch.music_failed + failed;
+}
+
+// ---------------- Hot reload ----------------
+bool ResourceManager::reload(std::string_view file) {
+    // 更新槽的字节统计（资源尺寸可能变化）
+    auto update_bytes = [](auto& storage, auto& slot, size_t bytes) {
+        storage.resident_bytes -= slot.bytes;
+        slot.bytes = bytes;
+        storage.resident_bytes += bytes;
+    };
+
+    if (auto it = textures_.indices.find(file); it != textures_.indices.end() && textures_.slots[it->second].resource) {
+        auto& slot = textures_.slots[it->second];
+        sf::Image image;
+        if (!image.loadFromFile(slot.key) || !slot.resource->loadFromImage(image)) {
+            spdlog::error("重新加载纹理 '{}' 失败，保留旧内容", file);
+            return false;
+        }
+        update_bytes(textures_, slot, texture_bytes(*slot.resource));
+        spdlog::info("已重新加载纹理 '{}'", file);
+        return true;
+    }
+    if (auto it = sounds_.indices.find(file); it != sounds_.indices.end() && sounds_.slots[it->second].resource) {
+        auto& slot = sounds_.slots[it->second];
+        if (!slot.resource->loadFromFile(slot.key)) {
+            spdlog::error("重新加载音效 '{}' 失败", file);
+            return false;
+        }
+        update_bytes(sounds_, slot, sound_bytes(*slot.resource));
+        spdlog::info("已重新加载音效 '{}'", file);
+        return true;
+    }
+    return false;
+}
+
+// ---------------- Residency ----------------
+uint32_t ResourceManager::begin_residency_scope() {
+    auto scope_id = next_scope_id_++;
+    scopes_.emplace(scope_id, std::vector<std::pair<ResourceType, uint32_t>>{});
+    spdlog::trace("创建驻留作用域 {}", scope_id);
+    return scope_id;
+}
+
+void ResourceManager::release_residency_scope(uint32_t scope_id) {
+    auto node = scopes_.extract(scope_id);
+    if (node.empty()) return;
+    if (active_scope_ == scope_id) active_scope_ = 0;
+
+    for (auto [type, index] : node.mapped()) {
+        switch (type) {
+            case ResourceType::Texture: release_reference(textures_, index); break;
+            case ResourceType::Sound: release_reference(sounds_, index); break;
+            case ResourceType::Font: release_reference(fonts_, index); break;
+            case ResourceType::Music: break;
+        }
+    }
+    enforce_memory_budget();
+    spdlog::debug("释放驻留作用域 {}，当前驻留 纹理 {} 字节，音效 {} 字节，字体 {} 字节", scope_id
+                , textures_.resident_bytes, sounds_.resident_bytes, fonts_.resident_bytes);
+}
+
+void ResourceManager::set_memory_budget(size_t bytes) {
+    memory_budget_ = bytes;
+    enforce_memory_budget();
+}
+
+size_t ResourceManager::get_resident_bytes(ResourceType type) const {
+    switch (type) {
+        case ResourceType::Texture: return textures_.resident_bytes;
+        case ResourceType::Sound: return sounds_.resident_bytes;
+        case ResourceType::Music: return musics_.resident_bytes;
+        case ResourceType::Font: return fonts_.resident_bytes;
+    }
+    return 0;
+}
+
+void ResourceManager::enforce_memory_budget() {
+    if (memory_budget_ == 0) return;
+
+    // 在一类资源中找出最久未使用、且没有被任何作用域引用的槽，返回（下标, 访问时刻）
+    auto find_lru = [](const auto& storage) -> std::pair<uint32_t, uint64_t> {
+        std::pair<uint32_t, uint64_t> best = {NO_SLOT, std::numeric_limits<uint64_t>::max()};
+        for (uint32_t i = 0; i < storage.slots.size(); ++i) {
+            const auto& slot = storage.slots[i];
+            if (slot.resource && slot.ref_count == 0 && slot.last_used < best.second) {
+                best = {i, slot.last_used};
+            }
+        }
+        return best;
+    };
+
+    while (textures_.resident_bytes + sounds_.resident_bytes > memory_budget_) {
+        auto texture_lru = find_lru(textures_);
+        auto sound_lru = find_lru(sounds_);
+        if (texture_lru.first == NO_SLOT && sound_lru.first == NO_SLOT) {
+            spdlog::debug("驻留资源超出预算 {} 字节，但剩余资源均被引用，无法淘汰", memory_budget_);
+            return;
+        }
+        if (texture_lru.second <= sound_lru.second) {
+            release_slot(textures_, texture_lru.first);
+        } else {
+            release_slot(sounds_, sound_lru.first);
+        }
+    }
 }
 
 // ---------------- All ----------------
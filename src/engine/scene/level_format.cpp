@@ -0,0 +1,340 @@
+#include "level_format.hpp"
+#include "tilelayer_component.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace engine::scene::level_format {
+namespace {
+static_assert(std::endian::native == std::endian::little, "二进制关卡格式按小端序直接读写");
+
+/// @brief 顺序写入基本类型与字符串
+class Writer {
+public:
+    template<typename T> requires std::is_arithmetic_v<T>
+    void write(T value) {
+        auto offset = buffer_.size();
+        buffer_.resize(offset + sizeof(T));
+        std::memcpy(buffer_.data() + offset, &value, sizeof(T));
+    }
+    void write(std::string_view str) {
+        write(static_cast<uint32_t>(str.size()));
+        auto offset = buffer_.size();
+        buffer_.resize(offset + str.size());
+        std::memcpy(buffer_.data() + offset, str.data(), str.size());
+    }
+    void write(sf::Vector2i v) { write(v.x); write(v.y); }
+    void write(sf::Vector2f v) { write(v.x); write(v.y); }
+    void write(sf::IntRect rect) { write(rect.position); write(rect.size); }
+    void write(sf::FloatRect rect) { write(rect.position); write(rect.size); }
+    void write(const TileData& tile) {
+        write(tile.texture);
+        write(tile.rect);
+        write(static_cast<uint8_t>(tile.type));
+    }
+
+    std::vector<std::byte> take() { return std::move(buffer_); }
+
+private:
+    std::vector<std::byte> buffer_;
+};
+
+/// @brief 顺序读取（带越界检查，任何一次越界后 ok() 为 false，后续读取均返回默认值）
+class Reader {
+public:
+    explicit Reader(std::span<const std::byte> bytes) : bytes_{bytes} {}
+
+    bool ok() const { return ok_; }
+
+    template<typename T> requires std::is_arithmetic_v<T>
+    T read() {
+        T value{};
+        if (!require(sizeof(T))) return value;
+        std::memcpy(&value, bytes_.data() + pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return value;
+    }
+    std::string read_string() {
+        auto length = read<uint32_t>();
+        if (!require(length)) return {};
+        std::string str(reinterpret_cast<const char*>(bytes_.data() + pos_), length);
+        pos_ += length;
+        return str;
+    }
+    /// @brief 读取数组长度，并确认剩余数据至少能容纳 count 个最小尺寸的元素（防止损坏文件导致巨量分配）
+    uint32_t read_count(size_t min_element_size) {
+        auto count = read<uint32_t>();
+        if (!require(static_cast<size_t>(count) * min_element_size)) return 0;
+        return count;
+    }
+    sf::Vector2i read_vector2i() { auto x = read<int32_t>(); return {x, read<int32_t>()}; }
+    sf::Vector2f read_vector2f() { auto x = read<float>(); return {x, read<float>()}; }
+    sf::IntRect read_int_rect() { auto position = read_vector2i(); return {position, read_vector2i()}; }
+    sf::FloatRect read_float_rect() { auto position = read_vector2f(); return {position, read_vector2f()}; }
+    TileData read_tile() {
+        TileData tile;
+        tile.texture = read<uint32_t>();
+        tile.rect = read_int_rect();
+        tile.type = static_cast<engine::component::TileType>(read<uint8_t>());
+        return tile;
+    }
+    bool skip(size_t size) {
+        if (!require(size)) return false;
+        pos_ += size;
+        return true;
+    }
+
+private:
+    bool require(size_t size) {
+        if (!ok_ || bytes_.size() - pos_ < size) ok_ = false;
+        return ok_;
+    }
+
+    std::span<const std::byte> bytes_;
+    size_t pos_ = 0;
+    bool ok_ = true;
+};
+
+constexpr size_t TILE_RECORD_SIZE = 4 + 16 + 1;
+constexpr size_t STRING_MIN_SIZE = 4;
+
+void write_prototype(Writer& writer, const PrototypeData& prototype) {
+    writer.write(prototype.source);
+    writer.write(prototype.tile);
+    writer.write(static_cast<uint8_t>(prototype.collider));
+    writer.write(prototype.collider_rect);
+    writer.write(prototype.tag);
+    writer.write(static_cast<uint8_t>(prototype.gravity ? (prototype.gravity.value() ? 2 : 1) : 0));    // 0 未设置，1 false，2 true
+    writer.write(static_cast<uint8_t>(prototype.health.has_value()));
+    writer.write(static_cast<int32_t>(prototype.health.value_or(0)));
+    writer.write(static_cast<uint32_t>(prototype.animations.size()));
+    for (const auto& animation : prototype.animations) {
+        writer.write(animation.name);
+        writer.write(static_cast<uint32_t>(animation.frames.size()));
+        for (const auto& frame : animation.frames) {
+            writer.write(frame.rect);
+            writer.write(frame.duration);
+        }
+    }
+    writer.write(static_cast<uint32_t>(prototype.sounds.size()));
+    for (const auto& sound : prototype.sounds) {
+        writer.write(sound.id);
+        writer.write(sound.path);
+    }
+}
+
+PrototypeData read_prototype(Reader& reader) {
+    PrototypeData prototype;
+    prototype.source = reader.read_string();
+    prototype.tile = reader.read_tile();
+    prototype.collider = static_cast<ColliderKind>(reader.read<uint8_t>());
+    prototype.collider_rect = reader.read_float_rect();
+    prototype.tag = reader.read_string();
+    if (auto gravity = reader.read<uint8_t>(); gravity != 0) prototype.gravity = gravity == 2;
+    auto has_health = reader.read<uint8_t>() != 0;
+    auto health = reader.read<int32_t>();
+    if (has_health) prototype.health = health;
+    prototype.animations.resize(reader.read_count(STRING_MIN_SIZE + 4));
+    for (auto& animation : prototype.animations) {
+        animation.name = reader.read_string();
+        animation.frames.resize(reader.read_count(16 + 4));
+        for (auto& frame : animation.frames) {
+            frame.rect = reader.read_int_rect();
+            frame.duration = reader.read<float>();
+        }
+    }
+    prototype.sounds.resize(reader.read_count(STRING_MIN_SIZE * 2));
+    for (auto& sound : prototype.sounds) {
+        sound.id = reader.read_string();
+        sound.path = reader.read_string();
+    }
+    return prototype;
+}
+
+void write_object(Writer& writer, const ObjectData& object) {
+    writer.write(static_cast<uint8_t>(object.kind));
+    writer.write(object.name);
+    writer.write(object.position);
+    writer.write(object.size);
+    writer.write(object.rotation);
+    if (object.kind == ObjectData::Kind::Shape) {
+        writer.write(object.tag);
+        writer.write(static_cast<uint8_t>(object.trigger));
+    } else {
+        writer.write(object.prototype);
+    }
+}
+
+ObjectData read_object(Reader& reader) {
+    ObjectData object;
+    object.kind = static_cast<ObjectData::Kind>(reader.read<uint8_t>());
+    object.name = reader.read_string();
+    object.position = reader.read_vector2f();
+    object.size = reader.read_vector2f();
+    object.rotation = reader.read<float>();
+    if (object.kind == ObjectData::Kind::Shape) {
+        object.tag = reader.read_string();
+        object.trigger = reader.read<uint8_t>() != 0;
+    } else {
+        object.prototype = reader.read<uint32_t>();
+    }
+    return object;
+}
+} // namespace
+
+std::vector<std::byte> write_level(const LevelData& level) {
+    Writer writer;
+    for (auto c : MAGIC) writer.write(c);
+    writer.write(VERSION);
+    writer.write(level.map_size);
+    writer.write(static_cast<uint8_t>(level.infinite));
+    writer.write(level.tile_size);
+    writer.write(level.music);
+
+    writer.write(static_cast<uint32_t>(level.dependencies.size()));
+    for (const auto& dependency : level.dependencies) {
+        writer.write(dependency.path);
+        writer.write(dependency.content_hash);
+        writer.write(dependency.file_size);
+        writer.write(dependency.file_time);
+    }
+
+    writer.write(static_cast<uint32_t>(level.textures.size()));
+    for (const auto& texture : level.textures) writer.write(texture);
+
+    writer.write(static_cast<uint32_t>(level.prototypes.size()));
+    for (const auto& prototype : level.prototypes) write_prototype(writer, prototype);
+
+    writer.write(static_cast<uint32_t>(level.layers.size()));
+    for (const auto& layer : level.layers) {
+        writer.write(static_cast<uint8_t>(layer.type));
+        writer.write(layer.name);
+        switch (layer.type) {
+            case LayerData::Type::Image:
+                writer.write(layer.texture);
+                writer.write(layer.offset);
+                writer.write(layer.scroll_factor);
+                writer.write(static_cast<uint8_t>(layer.repeat.x));
+                writer.write(static_cast<uint8_t>(layer.repeat.y));
+                break;
+            case LayerData::Type::Tile:
+                writer.write(static_cast<uint32_t>(layer.tiles.size()));
+                for (const auto& tile : layer.tiles) writer.write(tile);
+                writer.write(static_cast<uint32_t>(layer.chunks.size()));
+                for (const auto& chunk : layer.chunks) {
+                    writer.write(chunk.position);
+                    writer.write(chunk.size);
+                    writer.write(static_cast<uint32_t>(chunk.tiles.size()));
+                    for (const auto& tile : chunk.tiles) writer.write(tile);
+                }
+                break;
+            case LayerData::Type::Object:
+                writer.write(static_cast<uint32_t>(layer.objects.size()));
+                for (const auto& object : layer.objects) write_object(writer, object);
+                break;
+        }
+    }
+    return writer.take();
+}
+
+std::optional<LevelData> read_level(std::span<const std::byte> bytes) {
+    if (bytes.size() < MAGIC.size() + 4 || std::memcmp(bytes.data(), MAGIC.data(), MAGIC.size()) != 0) {
+        spdlog::error("二进制关卡数据格式错误（魔数不符）");
+        return std::nullopt;
+    }
+    Reader reader{bytes};
+    reader.skip(MAGIC.size());
+    if (auto version = reader.read<uint32_t>(); version != VERSION) {
+        spdlog::warn("二进制关卡版本 {} 不受支持（需要 {}）", version, VERSION);
+        return std::nullopt;
+    }
+
+    LevelData level;
+    level.map_size = reader.read_vector2i();
+    level.infinite = reader.read<uint8_t>() != 0;
+    level.tile_size = reader.read_vector2i();
+    level.music = reader.read_string();
+
+    level.dependencies.resize(reader.read_count(STRING_MIN_SIZE + 24));
+    for (auto& dependency : level.dependencies) {
+        dependency.path = reader.read_string();
+        dependency.content_hash = reader.read<uint64_t>();
+        dependency.file_size = reader.read<uint64_t>();
+        dependency.file_time = reader.read<int64_t>();
+    }
+
+    level.textures.resize(reader.read_count(STRING_MIN_SIZE));
+    for (auto& texture : level.textures) texture = reader.read_string();
+
+    level.prototypes.resize(reader.read_count(STRING_MIN_SIZE + TILE_RECORD_SIZE + 1 + 16 + STRING_MIN_SIZE));
+    for (auto& prototype : level.prototypes) {
+        prototype = read_prototype(reader);
+        if (!reader.ok()) break;
+    }
+
+    level.layers.resize(reader.read_count(1 + STRING_MIN_SIZE));
+    for (auto& layer : level.layers) {
+        auto type = reader.read<uint8_t>();
+        if (type > static_cast<uint8_t>(LayerData::Type::Object)) {
+            spdlog::error("二进制关卡中存在未知图层类型 {}", type);
+            return std::nullopt;
+        }
+        layer.type = static_cast<LayerData::Type>(type);
+        layer.name = reader.read_string();
+        switch (layer.type) {
+            case LayerData::Type::Image:
+                layer.texture = reader.read<uint32_t>();
+                layer.offset = reader.read_vector2f();
+                layer.scroll_factor = reader.read_vector2f();
+                layer.repeat.x = reader.read<uint8_t>() != 0;
+                layer.repeat.y = reader.read<uint8_t>() != 0;
+                break;
+            case LayerData::Type::Tile:
+                layer.tiles.resize(reader.read_count(TILE_RECORD_SIZE));
+                for (auto& tile : layer.tiles) tile = reader.read_tile();
+                layer.chunks.resize(reader.read_count(16 + 4));
+                for (auto& chunk : layer.chunks) {
+                    chunk.position = reader.read_vector2i();
+                    chunk.size = reader.read_vector2i();
+                    chunk.tiles.resize(reader.read_count(TILE_RECORD_SIZE));
+                    for (auto& tile : chunk.tiles) tile = reader.read_tile();
+                }
+                break;
+            case LayerData::Type::Object:
+                layer.objects.resize(reader.read_count(1 + STRING_MIN_SIZE));
+                for (auto& object : layer.objects) object = read_object(reader);
+                break;
+        }
+        if (!reader.ok()) break;
+    }
+
+    if (!reader.ok()) {
+        spdlog::error("二进制关卡数据不完整");
+        return std::nullopt;
+    }
+    // 纹理与原型下标必须落在各自的表内，避免加载时越界
+    auto texture_valid = [&](const TileData& tile) { return tile.texture < level.textures.size(); };
+    bool valid = !level.textures.empty()
+              && std::ranges::all_of(level.prototypes, [&](const PrototypeData& prototype) { return texture_valid(prototype.tile); });
+    for (const auto& layer : level.layers) {
+        valid = valid
+             && (layer.type != LayerData::Type::Image || layer.texture < level.textures.size())
+             && std::ranges::all_of(layer.tiles, texture_valid)
+             && std::ranges::all_of(layer.chunks, [&](const ChunkData& chunk) {
+                    return std::ranges::all_of(chunk.tiles, texture_valid);
+                })
+             && std::ranges::all_of(layer.objects, [&](const ObjectData& object) {
+                    return object.kind == ObjectData::Kind::Shape || object.prototype < level.prototypes.size();
+                });
+    }
+    if (!valid) {
+        spdlog::error("二进制关卡中的纹理或原型下标越界");
+        return std::nullopt;
+    }
+    return level;
+}
+
+} // namespace engine::scene::level_format
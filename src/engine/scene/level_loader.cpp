@@ -1,5 +1,10 @@
 #include "level_loader.hpp"
+#include "level_parser.hpp"
+#include "level_format.hpp"
+#include "content_hash.hpp"
 #include "resource_manager.hpp"
+#include "thread_pool.hpp"
+#include "audio_player.hpp"
 #include "scene.hpp"
 #include "game_object.hpp"
 #include "component.hpp"
@@ -15,11 +20,28 @@
 #include "audio_component.hpp"
 #include <spdlog/spdlog.h>
 #include <SFML/System/Vector2.hpp>
-#include <fstream>
+#include <algorithm>
+#include <chrono>
 #include <filesystem>
+#include <iterator>
 #include <optional>
 
 namespace engine::scene {
+/// @brief 并行准备阶段的产物，按图层顺序串行插入场景
+struct LevelLoader::PreparedLayer {
+    std::vector<std::vector<engine::component::TileInfo>> tile_batches;     ///< @brief 有限瓦片层：按批次生成的瓦片
+    std::vector<engine::component::TileChunk> chunks;                       ///< @brief 无限瓦片层：区块数据
+    std::vector<std::unique_ptr<engine::object::GameObject>> objects;       ///< @brief 图片层（1 个）/ 对象层（每个对象一个）
+};
+
+/// @brief 由原型编译得到的预制体：每个原型只构建一次动画片段并解析一次音效句柄，实例化对象时直接复用
+struct LevelLoader::Prefab {
+    const PrototypeData* data;                                                  ///< @brief 原型数据
+    sf::Sprite sprite;                                                          ///< @brief 图片（实例直接拷贝）
+    std::vector<const engine::render::Animation*> animations;                   ///< @brief 动画片段（AnimationLibrary 中的共享片段）
+    std::vector<engine::resource::SoundHandle> sounds;                          ///< @brief 与 data->sounds 一一对应的音效句柄
+};
+
 LevelLoader::LevelLoader(engine::core::Context& context)
     : context_{context} {
 }
@@ -27,561 +49,382 @@ LevelLoader::LevelLoader(engine::core::Context& context)
 LevelLoader::~LevelLoader() = default;
 
 bool LevelLoader::load_level(std::string_view level_path, Scene& scene) {
-    map_path_ = level_path;
-    auto path = std::filesystem::path(level_path);
-    // 1、加载 josn 文件
-    std::ifstream file(path);
-        if (!file.is_open()) {
-        spdlog::error("无法打开关卡文件: {}", level_path);
-        return false;
-    }
-
-    // 2、解析 json 数据
-    nlohmann::json json_data;
-    try {
-        file >> json_data;
-    } catch (const nlohmann::json::parse_error& e) {
-        spdlog::error("解析 JSON 数据失败: {}", e.what());
-        return false;
+    // 读取关卡数据（若已由 collect_manifest() 读取过则直接复用）
+    const auto* level = get_level_data(level_path);
+    if (!level) return false;
+    auto start_time = std::chrono::steady_clock::now();
+
+    resolve_textures(*level);
+    compile_prefabs(*level);
+    object_arena_obs_ = &scene.get_object_arena();      // 准备阶段在工作线程中创建对象，直接从场景的内存池分配
+    auto setup_time = std::chrono::steady_clock::now();
+
+    // 1、拆分准备任务：瓦片按批次、区块与对象按数量切分，图片层各一个任务
+    std::vector<PreparedLayer> prepared(level->layers.size());
+    std::vector<PrepareTask> tasks;
+    for (size_t i = 0; i < level->layers.size(); ++i) {
+        const auto& layer = level->layers[i];
+        size_t count = 1;
+        size_t batch = 1;
+        switch (layer.type) {
+            case LayerData::Type::Image:
+                prepared[i].objects.resize(1);
+                break;
+            case LayerData::Type::Tile:
+                if (level->infinite) {
+                    count = layer.chunks.size();
+                    batch = CHUNK_BATCH_SIZE;
+                    prepared[i].chunks.resize(count);
+                } else {
+                    count = layer.tiles.size();
+                    batch = TILE_BATCH_SIZE;
+                    prepared[i].tile_batches.resize((count + batch - 1) / batch);
+                }
+                break;
+            case LayerData::Type::Object:
+                count = layer.objects.size();
+                batch = OBJECT_BATCH_SIZE;
+                prepared[i].objects.resize(count);
+                break;
+        }
+        for (size_t begin = 0; begin < count; begin += batch) {
+            tasks.push_back({i, begin, std::min(begin + batch, count)});
+        }
     }
 
-    // 3. 获取基本地图信息 (名称、地图尺寸、瓦片尺寸)
-    map_path_ = level_path;
-    map_size_ = sf::Vector2i(json_data.value("width", 0), json_data.value("height", 0));
-    tile_size_ = sf::Vector2i(json_data.value("tilewidth", 0), json_data.value("tileheight", 0));
-
-    // 4. 加载 tileset 数据
-    if (json_data.contains("tilesets") && json_data["tilesets"].is_array()) {
-        for (const auto& tileset_json : json_data["tilesets"]) {
-            if (!tileset_json.contains("source") || !tileset_json["source"].is_string() ||
-                !tileset_json.contains("firstgid") || !tileset_json["firstgid"].is_number_integer()) {
-                spdlog::error("tilesets 对象中缺少有效 'source' 或 'firstgid' 字段。");
-                continue;
-            }
-            auto tileset_path = resolve_path(tileset_json["source"].get<std::string>(), map_path_);  // 支持隐式转换，可以省略.get<T>()方法，
-            auto first_gid = tileset_json["firstgid"];
-            load_tileset(tileset_path, first_gid);
+    // 2、并行准备：创建精灵、区块数据以及不涉及共享状态的组件，结果写入各自的槽位
+    auto run_tasks = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const auto& task = tasks[i];
+            prepare_layer(level->layers[task.layer], task.begin, task.end, prepared[task.layer]);
         }
+    };
+    if (parallel_prepare_) {
+        context_.get_thread_pool().parallel_for(tasks.size(), 1, run_tasks);
+    } else {
+        run_tasks(0, tasks.size());
     }
+    auto prepared_time = std::chrono::steady_clock::now();
 
-    // 5、加载图层数据
-    if (!json_data.contains("layers") || !json_data["layers"].is_array()) {       // 地图文件中必须有 layers 数组
-        spdlog::error("地图文件 '{}' 中缺少或无效的 'layers' 数组。", level_path);
-        return false;
+    // 3、串行插入：按 Tiled 中的图层与对象顺序添加到场景（注册物理组件、音效等共享状态也在这里完成）
+    for (size_t i = 0; i < level->layers.size(); ++i) {
+        add_prepared_layer(level->layers[i], prepared[i], scene);
     }
-    for (const auto& layer_json : json_data["layers"]) {
-        // 获取各图层对象中的类型（type）字段
-        std::string layer_type = layer_json.value("type", "none");
-        if (!layer_json.value("visible", true)) {
-            spdlog::info("图层 '{}' 不可见，跳过加载。", layer_json.value("name", "Unnamed"));
-            continue;
-        }
+    prefabs_.clear();
+    textures_.clear();
+    object_arena_obs_ = nullptr;
+
+    auto end_time = std::chrono::steady_clock::now();
+    auto to_ms = [](auto duration) { return std::chrono::duration<double, std::milli>(duration).count(); };
+    last_stats_ = {tasks.size(), to_ms(setup_time - start_time), to_ms(prepared_time - setup_time), to_ms(end_time - prepared_time)};
+    spdlog::info("关卡加载完成: {}（纹理与预制体 {:.3f} ms，{} 个准备任务{} {:.3f} ms，插入 {:.3f} ms）", level_path
+                , last_stats_.setup_ms, tasks.size(), parallel_prepare_ ? "并行" : "串行", last_stats_.prepare_ms, last_stats_.insert_ms);
+    scene.get_object_arena().log_stats("关卡加载后");
+    return true;
+}
 
-        // 根据图层类型决定加载方法
-        if (layer_type == "imagelayer") {
-            load_image_layer(layer_json, scene);
-        } else if (layer_type == "tilelayer") {
-            load_tile_layer(layer_json, scene);
-        } else if (layer_type == "objectgroup") {
-            load_object_layer(layer_json, scene);
-        } else {
-            spdlog::warn("不支持的图层类型: {}", layer_type);
-        }
+bool LevelLoader::collect_manifest(std::string_view level_path, engine::resource::ResourceManifest& manifest) {
+    const auto* level = get_level_data(level_path);
+    if (!level) return false;
+
+    // 纹理表只包含图片层与实际用到的瓦片图片，不会把图块集中未使用的图片也加载进来
+    for (const auto& texture : level->textures) {
+        manifest.add_texture(texture);
+    }
+    // 音效只在首次播放时才会用到，必须提前加载
+    for (const auto& prototype : level->prototypes) {
+        for (const auto& sound : prototype.sounds) manifest.add_sound(sound.path);
+    }
+    // 地图自定义属性中可以指定背景音乐
+    if (!level->music.empty()) {
+        manifest.add_music(level->music);
     }
 
-    spdlog::info("关卡加载完成: {}", level_path);
+    spdlog::info("关卡 '{}' 资源清单：纹理 {}，音效 {}，音乐 {}", level_path
+                , manifest.textures.size(), manifest.sounds.size(), manifest.musics.size());
     return true;
 }
 
-void LevelLoader::load_image_layer(const nlohmann::json& layer_json, Scene& scene) {
-    // 获取纹理相对路径 （会自动处理'\/'符号）
-    std::string image_path = layer_json.value("image", "");     // json.value()返回的是一个临时对象，需要赋值才能保存，
-                                                                // 不能用std::string_view
-    if (image_path.empty()) {
-        spdlog::error("图层 '{}' 缺少 'image' 属性。", layer_json.value("name", "Unnamed"));
-        return;
+const LevelData* LevelLoader::get_level_data(std::string_view level_path) {
+    if (level_data_ && level_path_ == level_path) return &level_data_.value();
+    level_path_ = level_path;
+    level_data_ = read_compiled_level(level_path);
+    if (!level_data_) {
+        auto& resource_manager = context_.get_resource_manager();
+        LevelParser parser([&resource_manager](std::string_view path) { return resource_manager.read_asset(path); }
+                         , context_.get_tileset_registry());
+        level_data_ = parser.parse(level_path);
     }
-    auto texture_id = resolve_path(image_path, map_path_);
-
-    // 获取图层偏移量（json中没有则代表未设置，给默认值即可）
-    const sf::Vector2f offset = sf::Vector2f(layer_json.value("offsetx", 0.f), layer_json.value("offsety", 0.f));
+    return level_data_ ? &level_data_.value() : nullptr;
+}
 
-    // 获取视差因子及重复标志
-    const sf::Vector2f scroll_factor = sf::Vector2f(layer_json.value("parallaxx", 1.f), layer_json.value("parallaxy", 1.f));
-    const sf::Vector2<bool> repeat = sf::Vector2<bool>(layer_json.value("repeatx", false), layer_json.value("repeaty", false));
+std::optional<LevelData> LevelLoader::read_compiled_level(std::string_view level_path) const {
+    auto compiled_path = std::filesystem::path(level_path).replace_extension(level_format::EXTENSION).generic_string();
 
-    // 获取图层名称
-    std::string layer_name = layer_json.value("name", "Unnamed");
+    // 资源包中的数据本身就是映射内存；散文件单独映射
+    auto& resource_manager = context_.get_resource_manager();
+    std::optional<engine::resource::AssetData> file = resource_manager.get_archive().load(compiled_path);
+    if (!file) file = engine::resource::AssetData::map_file(compiled_path);
+    if (!file) return std::nullopt;
 
-    /*  可用类似方法获取其它各种属性，这里我们暂时用不上 */
+    auto level = level_format::read_level(file->bytes());
+    if (!level) {
+        spdlog::warn("编译关卡 '{}' 无法使用，改为解析 '{}'", compiled_path, level_path);
+        return std::nullopt;
+    }
 
-    // 创建游戏对象
-    auto game_object = std::make_unique<engine::object::GameObject>(layer_name);
-    // 依次添加Transform，Parallax组件
-    game_object->add_component<engine::component::TransformComponent>(offset);
-    game_object->add_component<engine::component::ParallaxComponent>(*context_.get_resource_manager().get_texture(texture_id), scroll_factor, repeat);
-    // 添加到场景中
-    scene.add_game_object(std::move(game_object));
-    spdlog::info("加载图层: '{}' 完成", layer_name);
+    // 编译后修改过地图或任一图块集（例如在 Tiled 中保存后热重载）时，编译结果已过期。
+    // 源文件不存在（只发布了编译结果）时无法校验，也无法回退，直接使用编译结果
+    for (const auto& dependency : level->dependencies) {
+        if (!dependency_may_have_changed(dependency)) continue;
+        auto source = resource_manager.read_asset(dependency.path);
+        if (source && engine::utils::hash_content(source->bytes()) != dependency.content_hash) {
+            spdlog::info("编译关卡 '{}' 的源文件 '{}' 已修改，改为解析 '{}'", compiled_path, dependency.path, level_path);
+            return std::nullopt;
+        }
+    }
+    spdlog::info("已读取编译关卡: {}", compiled_path);
+    return level;
 }
 
-void LevelLoader::load_tile_layer(const nlohmann::json& layer_json, Scene& scene) {
-    if (!layer_json.contains("data") || !layer_json["data"].is_array()) {
-        spdlog::error("图层 '{}' 缺少 'data' 属性。", layer_json.value("name", "Unnamed"));
-        return;
+bool LevelLoader::dependency_may_have_changed(const DependencyData& dependency) const {
+    // 资源包中的源文件与编译结果一起打包，只比较索引中记录的大小，不解压
+    if (auto size = context_.get_resource_manager().get_archive().find_size(dependency.path)) {
+        return *size != dependency.file_size;
     }
-    // 准备 TileInfo Vector (瓦片数量 = 地图宽度 * 地图高度)
-    std::vector<engine::component::TileInfo> tiles;
-    tiles.reserve(map_size_.x * map_size_.y);
-
-    // 获取图层数据 (瓦片 ID 列表)
-    const auto& data = layer_json["data"];
 
-    // 根据gid获取必要信息，并依次填充 TileInfo Vector
-    for (const auto& gid : data) {
-        tiles.push_back(get_tile_info_by_gid(gid));
-    }
+    // 散文件：大小与修改时间都与编译时一致就不读取源文件；在编辑器中保存（资源监视器报告变化）会更新修改时间
+    std::error_code error;
+    auto size = std::filesystem::file_size(dependency.path, error);
+    if (error) return false;        // 源文件不存在
+    auto time = std::filesystem::last_write_time(dependency.path, error);
+    if (error || dependency.file_time == 0) return true;
+    return size != dependency.file_size || time.time_since_epoch().count() != dependency.file_time;
+}
 
-    // 获取图层名称
-    std::string layer_name = layer_json.value("name", "Unnamed");
-    // 创建游戏对象
-    auto game_object = std::make_unique<engine::object::GameObject>(layer_name);
-    // 添加Tilelayer组件
-    game_object->add_component<engine::component::TileLayerComponent>(tile_size_, map_size_, std::move(tiles));
-    // 添加到场景中
-    scene.add_game_object(std::move(game_object));
-    spdlog::info("加载瓦片图层: '{}' 完成", layer_name);
+sf::Sprite LevelLoader::make_sprite(const TileData& tile) const {
+    const auto* texture = textures_[tile.texture] ? textures_[tile.texture] : textures_[DEFAULT_TEXTURE_INDEX];
+    if (tile.rect.size == sf::Vector2i{}) return sf::Sprite(*texture);
+    return sf::Sprite(*texture, tile.rect);
 }
 
-void LevelLoader::load_object_layer(const nlohmann::json& layer_json, Scene& scene) {
-    if (!layer_json.contains("objects") || !layer_json["objects"].is_array()) {
-        spdlog::error("对象图层 '{}' 缺少 'objects' 属性。", layer_json.value("name", "Unnamed"));
-        return;
+void LevelLoader::resolve_textures(const LevelData& level) {
+    auto& resource_manager = context_.get_resource_manager();
+    // 通常已由场景预加载；未预加载的纹理在这里交给线程池并行解码，而不是在下面逐个同步加载
+    engine::resource::ResourceManifest missing;
+    for (const auto& texture_path : level.textures) {
+        if (!resource_manager.find_texture(texture_path)) missing.add_texture(texture_path);
+    }
+    if (!missing.textures.empty()) {
+        spdlog::info("关卡有 {} 个纹理未预加载，并行解码", missing.textures.size());
+        resource_manager.preload(missing);
     }
-    // 获取对象数据
-    const auto& objects = layer_json["objects"];
-    // 遍历对象数据
-    for (const auto& object : objects) {
-        // 获取对象gid
-        auto gid = object.value("gid", 0);
-        if (gid == 0) {    // 如果gid为0（即不存在），则代表自己绘制的形状（可能是碰撞盒、触发器，未来按需处理）
-            // 非矩形对象会有额外标识（目前不考虑）
-            if (object.value("point", false)) {             // 如果是点对象
-                continue;       // TODO: 点对象的处理方式
-            } else if (object.value("ellipse", false)) {    // 如果是椭圆对象
-                continue;       // TODO: 椭圆对象的处理方式
-            } else if (object.value("polygon", false)) {    // 如果是多边形对象
-                continue;       // TODO: 多边形对象的处理方式
-            } else {    // 没有这些标识则默认是矩形对象
-                // --- 创建游戏对象并添加TransfromComponent ---
-                std::string object_name = object.value("name", "Unnamed");
-                auto game_object = std::make_unique<engine::object::GameObject>(object_name);
-                    // 获取Transform相关信息 （自定义形状的坐标针对左上角）
-                auto position = sf::Vector2f(object.value("x", 0.f), object.value("y", 0.f));
-                auto dst_size = sf::Vector2f(object.value("width", 0.f), object.value("height", 0.f));
-                auto rotation = object.value("rotation", 0.f);
-                    // 添加TransformComponent，缩放为设定为1.f
-                game_object->add_component<engine::component::TransformComponent>(position, sf::Vector2f(1.f, 1.f), sf::degrees(rotation));
-
-                // --- 添加碰撞组件和物理组件 ---
-                    // 碰撞盒大小与dst_size相同 
-                auto collider = std::make_unique<engine::physics::AABBCollider>(dst_size);
-                auto* cc = game_object->add_component<engine::component::ColliderComponent>(std::move(collider));
-                    // 自定义形状通常是trigger类型，除非显示指定 （因此默认为真）
-                cc->set_trigger(object.value("trigger", true));
-                    // 添加物理组件，不受重力影响
-                game_object->add_component<engine::component::PhysicsComponent>(&scene.get_context().get_physics_engine(), false);
-                
-                // 获取标签信息并设置
-                if (auto tag = get_tile_property<std::string>(object, "tag"); tag) {  // 如果有标签
-                    game_object->set_tag(tag.value());
-                }
-                // 添加到场景
-                scene.add_game_object(std::move(game_object));
-                spdlog::info("加载对象: '{}' 完成 (类型: 自定义形状)", object_name);
-            }
-        } else {
-            // --- 根据gid获取必要信息，每个gid对应一个游戏对象 ---
-            auto tile_info = get_tile_info_by_gid(gid);
-
-            // 获取Transform相关信息
-            auto position = sf::Vector2f(object.value("x", 0.f), object.value("y", 0.f));
-            auto dst_size = sf::Vector2f(object.value("width", 0.f), object.value("height", 0.f));
-            position = sf::Vector2f(position.x, position.y - dst_size.y);   // 实际position需要进行调整（左下角到左上角）
-
-            auto rotation = sf::degrees(object.value("rotation", 0.f));
-            auto src_size = tile_info.sprite.getGlobalBounds().size;
-            auto scale = dst_size.componentWiseDiv(src_size);
-
-            // 获取对象名称
-            std::string object_name = object.value("name", "Unnamed");
-
-            // 创建游戏对象并添加组件
-            auto game_object = std::make_unique<engine::object::GameObject>(object_name);
-            game_object->add_component<engine::component::TransformComponent>(position, scale, rotation);
-            game_object->add_component<engine::component::SpriteComponent>(std::move(tile_info.sprite));
-
-            // 获取瓦片json信息      1. 必然存在，因为getTileInfoByGid(gid)函数已经顺利执行
-                                // 2. 这里再获取json，实际上检索了两次，未来可以优化
-            auto tile_json = get_tile_json_by_gid(gid);
-
-            // 获取碰信息：如果是SOLID类型，则添加物理组件，且图片源矩形区域就是碰撞盒大小
-            if (tile_info.type == engine::component::TileType::Solid) {
-                auto collider = std::make_unique<engine::physics::AABBCollider>(src_size);
-                game_object->add_component<engine::component::ColliderComponent>(std::move(collider));
-                // 物理组件不受重力影响
-                game_object->add_component<engine::component::PhysicsComponent>(&scene.get_context().get_physics_engine(), false);
-                // 设置标签方便物理引擎检索
-                game_object->set_tag("solid");
-            } else if (auto rect = get_collider_rect(tile_json); rect) { // 如果非SOLID类型，检查自定义碰撞盒是否存在
-                // 如果有，添加碰撞组件
-                auto collider = std::make_unique<engine::physics::AABBCollider>(rect->size);
-                auto* cc = game_object->add_component<engine::component::ColliderComponent>(std::move(collider));
-                cc->set_offset(rect->position);  // 自定义碰撞盒的坐标是相对于图片坐标，也就是针对Transform的偏移量
-                // 和物理组件（默认不受重力影响）
-                game_object->add_component<engine::component::PhysicsComponent>(&scene.get_context().get_physics_engine(), false);
-            }
 
-            // 获取标签信息并设置
-            auto tag = get_tile_property<std::string>(tile_json, "tag");
-            if (tag) {
-                game_object->set_tag(tag.value());
-            } else if (tile_info.type == engine::component::TileType::Hazard) {
-                // 如果是瓦片且没有手动设置标签，则自动设置为 "hazard"
-                game_object->set_tag("hazard");
-            }
+    // 纹理表一次性解析为纹理指针，之后按下标取用（准备阶段只读）
+    textures_.clear();
+    textures_.reserve(level.textures.size());
+    for (const auto& texture_path : level.textures) {
+        textures_.push_back(resource_manager.get_texture(texture_path));
+    }
+}
 
-            // 获取重力信息并设置
-            auto gravity = get_tile_property<bool>(tile_json, "gravity");
-            if (gravity) {
-                auto pc = game_object->get_component<engine::component::PhysicsComponent>();
-                if (pc) {
-                    pc->set_use_gravity(gravity.value());
-                } else {
-                    spdlog::warn("对象 '{}' 在设置重力信息时没有物理组件，请检查地图设置。", object_name);
-                    game_object->add_component<engine::component::PhysicsComponent>(&scene.get_context().get_physics_engine(), gravity.value());
-                }
+void LevelLoader::compile_prefabs(const LevelData& level) {
+    auto& audio_player = context_.get_audio_player();
+    auto& animation_library = context_.get_resource_manager().get_animation_library();
+    prefabs_.clear();
+    prefabs_.reserve(level.prototypes.size());
+    for (const auto& prototype : level.prototypes) {
+        Prefab prefab{&prototype, make_sprite(prototype.tile), {}, {}};
+        prefab.animations.reserve(prototype.animations.size());
+        for (const auto& anim_data : prototype.animations) {
+            auto animation = std::make_unique<engine::render::Animation>(anim_data.name);
+            for (const auto& frame : anim_data.frames) {
+                animation->add_frame(frame.rect, sf::seconds(frame.duration));
             }
+            // 同一来源瓦片的片段在库中只存一份（跨原型、跨关卡共享），内容相同时临时构建的片段被丢弃
+            prefab.animations.push_back(animation_library.add(prototype.source, std::move(animation)));
+        }
+        prefab.sounds.reserve(prototype.sounds.size());
+        for (const auto& sound : prototype.sounds) {
+            prefab.sounds.push_back(audio_player.get_sound_handle(sound.path));
+        }
+        prefabs_.push_back(std::move(prefab));
+    }
+    spdlog::debug("关卡编译了 {} 个对象预制体，动画库共 {} 个片段", prefabs_.size(), animation_library.size());
+}
 
-            // 获取动画信息并的设置
-            auto anim_string = get_tile_property<std::string>(tile_json, "animation");
-            if (anim_string) {
-                // 解析string为JSON对象
-                nlohmann::json anim_json;
-                try {
-                    anim_json = nlohmann::json::parse(anim_string.value());
-                } catch (const nlohmann::json::parse_error& e) {
-                    spdlog::error("解析动画 JSON 字符串失败: {}", e.what());
-                    continue;  // 跳过此对象
+void LevelLoader::prepare_layer(const LayerData& layer, size_t begin, size_t end, PreparedLayer& prepared) const {
+    switch (layer.type) {
+        case LayerData::Type::Image: {
+            auto game_object = engine::object::GameObject::create(*object_arena_obs_, layer.name);
+            game_object->add_component<engine::component::TransformComponent>(layer.offset);
+            game_object->add_component<engine::component::ParallaxComponent>(*textures_[layer.texture], layer.scroll_factor, layer.repeat);
+            prepared.objects[0] = std::move(game_object);
+            break;
+        }
+        case LayerData::Type::Tile:
+            if (level_data_->infinite) {
+                for (size_t i = begin; i < end; ++i) prepared.chunks[i] = make_chunk(layer.chunks[i]);
+                break;
+            }
+            {
+                auto& tiles = prepared.tile_batches[begin / TILE_BATCH_SIZE];
+                tiles.reserve(end - begin);
+                for (size_t i = begin; i < end; ++i) {
+                    auto sprite = make_sprite(layer.tiles[i]);
+                    tiles.emplace_back(sprite, layer.tiles[i].type);
                 }
-                // 添加AnimationComponent
-                auto* ac = game_object->add_component<engine::component::AnimationComponent>();
-                // 添加动画到 AnimationComponent
-                auto local_size = tile_info.sprite.getLocalBounds().size;
-                add_animation(anim_json, ac, static_cast<sf::Vector2i>(local_size));
             }
+            break;
+        case LayerData::Type::Object:
+            for (size_t i = begin; i < end; ++i) prepared.objects[i] = prepare_object(layer.objects[i]);
+            break;
+    }
+}
 
-            // 获取音效信息并设置
-            auto sound_string = get_tile_property<std::string>(tile_json, "sound");
-            if (sound_string) {
-                // 解析string为JSON对象
-                nlohmann::json sound_json;
-                try {
-                    sound_json = nlohmann::json::parse(sound_string.value());
-                } catch (const nlohmann::json::parse_error& e) {
-                    spdlog::error("解析音效 JSON 字符串失败: {}", e.what());
-                    continue;  // 跳过此对象
+void LevelLoader::add_prepared_layer(const LayerData& layer, PreparedLayer& prepared, Scene& scene) {
+    switch (layer.type) {
+        case LayerData::Type::Image:
+            scene.add_game_object(std::move(prepared.objects[0]));
+            spdlog::info("加载图层: '{}' 完成", layer.name);
+            break;
+        case LayerData::Type::Tile:
+            if (level_data_->infinite) {
+                add_chunked_tile_layer(layer, prepared, scene);
+            } else {
+                // 按批次顺序拼接瓦片 (瓦片数量 = 地图宽度 * 地图高度)
+                std::vector<engine::component::TileInfo> tiles;
+                tiles.reserve(layer.tiles.size());
+                for (auto& batch : prepared.tile_batches) {
+                    std::ranges::move(batch, std::back_inserter(tiles));
                 }
-                // 添加AudioComponent
-                auto* audio_component = game_object->add_component<engine::component::AudioComponent>(&scene.get_context().get_audio_player(), &scene.get_context().get_camera());
-                // 添加音效到 AudioComponent
-                add_sound(sound_json, audio_component);
+                auto game_object = scene.create_game_object(layer.name);
+                game_object->add_component<engine::component::TileLayerComponent>(level_data_->tile_size, level_data_->map_size, std::move(tiles));
+                scene.add_game_object(std::move(game_object));
+                spdlog::info("加载瓦片图层: '{}' 完成", layer.name);
             }
-
-            // 获取生命值信息并设置
-            auto health = get_tile_property<int>(tile_json, "health");
-            if (health) {
-                // 添加 HealthComponent
-                game_object->add_component<engine::component::HealthComponent>(health.value());
+            break;
+        case LayerData::Type::Object:
+            for (size_t i = 0; i < layer.objects.size(); ++i) {
+                finish_object(layer.objects[i], *prepared.objects[i], scene);
+                scene.add_game_object(std::move(prepared.objects[i]));
+                spdlog::info("加载对象：{} 完成", layer.objects[i].name);
             }
-            
-            // 添加到场景中
-            scene.add_game_object(std::move(game_object));
-            spdlog::info("加载对象：{} 完成", object_name);
-        }
+            break;
     }
 }
 
-void LevelLoader::add_animation(const nlohmann::json& anim_json, engine::component::AnimationComponent* ac, const sf::Vector2i& sprite_size) {
-    // 检查 anim_json 必须是一个对象，并且 ac 不能为 nullptr
-    if (!anim_json.is_object() || !ac) {
-        spdlog::error("无效的动画 JSON 或 AnimationComponent 指针。");
-        return;
-    }
-    // 遍历动画 JSON 对象中的每个键值对（动画名称 : 动画信息）
-    for (const auto& anim : anim_json.items()) {
-        std::string_view anim_name = anim.key();
-        const auto& anim_info = anim.value();
-        if (!anim_info.is_object()) {
-            spdlog::warn("动画 '{}' 的信息无效或为空。", anim_name);
-            continue;
-        }
-        // 获取可能存在的动画帧信息
-        auto duration_ms = anim_info.value("duration", 100);        // 默认持续时间为100毫秒
-        auto duration = static_cast<float>(duration_ms) / 1000.f;   // 转换为秒
-        auto row = anim_info.value("row", 0);                       // 默认行数为0
-        // 帧信息（数组）是必须存在的
-        if (!anim_info.contains("frames") || !anim_info["frames"].is_array()) {
-            spdlog::warn("动画 '{}' 缺少 'frames' 数组。", anim_name);
+engine::component::TileChunk LevelLoader::make_chunk(const ChunkData& chunk_data) const {
+    // 只转换为紧凑的区块数据（纹理指针 + 源矩形 + 类型），精灵与烘焙纹理由组件按相机范围创建
+    engine::component::TileChunk chunk;
+    chunk.position = chunk_data.position;
+    chunk.tiles.reserve(chunk_data.tiles.size());
+    for (const auto& tile : chunk_data.tiles) {
+        if (tile.type == engine::component::TileType::Empty) {
+            chunk.tiles.emplace_back();
             continue;
         }
-        // 创建一个Animation对象 (默认为循环播放)
-        auto animation = std::make_unique<engine::render::Animation>(anim_name);
-
-        // 遍历数组并进行添加帧信息到animation对象
-        for (const auto& frame : anim_info["frames"]) {
-            if (!frame.is_number_integer()) {
-                spdlog::warn("动画 {} 中 frames 数组格式错误！", anim_name);
-                continue;
-            }
-            auto column = frame.get<int>();
-            // 计算源矩形
-            sf::IntRect src_rect = { 
-                {column * sprite_size.x, 
-                row * sprite_size.y},
-                {sprite_size.x, 
-                sprite_size.y }
-            };
-            // 添加动画帧到 Animation
-            animation->add_frame(src_rect, sf::seconds(duration));
-        }
-        // 将 Animation 对象添加到 AnimationComponent 中
-        ac->add_animation(std::move(animation));
+        const auto* texture = textures_[tile.texture] ? textures_[tile.texture] : textures_[DEFAULT_TEXTURE_INDEX];
+        chunk.tiles.push_back({texture, tile.rect, tile.type});
     }
+    return chunk;
 }
 
-void LevelLoader::add_sound(const nlohmann::json& sound_json, engine::component::AudioComponent* audio_component) {
-    if (!sound_json.is_object() || !audio_component) {
-        spdlog::error("无效的音效 JSON 或 AudioComponent 指针。");
-        return;
-    }
-    // 遍历音效 JSON 对象中的每个键值对（音效id : 音效路径）
-    for (const auto& sound : sound_json.items()) {
-        std::string_view sound_id = sound.key();
-        std::string sound_path = sound.value();
-        if (sound_id.empty() || sound_path.empty() ) {
-            spdlog::warn("音效 '{}' 缺少必要信息。", sound_id);
+void LevelLoader::add_chunked_tile_layer(const LayerData& layer, PreparedLayer& prepared, Scene& scene) {
+    // 所有区块尺寸必须相同，以第一个非空区块为准
+    sf::Vector2i chunk_size;
+    std::vector<engine::component::TileChunk> chunks;
+    chunks.reserve(layer.chunks.size());
+    for (size_t i = 0; i < layer.chunks.size(); ++i) {
+        const auto& chunk_data = layer.chunks[i];
+        if (chunk_data.tiles.empty()) continue;
+        if (chunk_size == sf::Vector2i{}) chunk_size = chunk_data.size;
+        if (chunk_data.size != chunk_size) {
+            spdlog::warn("瓦片图层 '{}' 中区块 ({}, {}) 的尺寸与其它区块不同，已跳过。", layer.name, chunk_data.position.x, chunk_data.position.y);
             continue;
         }
-        // 添加音效到 AudioComponent
-        audio_component->add_sound(sound_id, sound_path);
+        chunks.push_back(std::move(prepared.chunks[i]));
     }
+    if (chunk_size == sf::Vector2i{}) chunk_size = {16, 16};    // 空图层：使用 Tiled 的默认区块尺寸
+
+    auto game_object = scene.create_game_object(layer.name);
+    game_object->add_component<engine::component::TileLayerComponent>(level_data_->tile_size, chunk_size, std::move(chunks));
+    scene.add_game_object(std::move(game_object));
+    spdlog::info("加载瓦片图层: '{}' 完成（无限地图，{} 个区块）", layer.name, layer.chunks.size());
 }
 
-std::optional<sf::FloatRect> LevelLoader::get_collider_rect(const nlohmann::json& tile_json) {
-    if (!tile_json.contains("objectgroup")) return std::nullopt;
-    auto& objectgroup = tile_json["objectgroup"];
-    if (!objectgroup.contains("objects")) return std::nullopt;
-    auto& objects = objectgroup["objects"];
-    for (const auto& object : objects) {    // 一个图片只支持一个碰撞器。如果有多个，则返回第一个不为空的
-        auto rect = sf::FloatRect(sf::Vector2f(object.value("x", 0.f), object.value("y", 0.f)),
-                                  sf::Vector2f(object.value("width", 0.f), object.value("height", 0.f)));
-        if (rect.size.x > 0 && rect.size.y > 0) {
-            return rect;
-        }
+std::unique_ptr<engine::object::GameObject> LevelLoader::prepare_object(const ObjectData& object) const {
+    auto game_object = engine::object::GameObject::create(*object_arena_obs_, object.name);
+
+    if (object.kind == ObjectData::Kind::Shape) {   // 自己绘制的形状（碰撞盒、触发器）
+        if (!object.tag.empty()) game_object->set_tag(object.tag);
+        // 自定义形状的坐标针对左上角，缩放设定为1.f
+        game_object->add_component<engine::component::TransformComponent>(object.position, sf::Vector2f(1.f, 1.f), sf::degrees(object.rotation));
+        // 碰撞盒大小与对象尺寸相同
+        auto collider = std::make_unique<engine::physics::AABBCollider>(object.size);
+        auto* cc = game_object->add_component<engine::component::ColliderComponent>(std::move(collider));
+        cc->set_trigger(object.trigger);
+        return game_object;
     }
-    return std::nullopt;    // 如果没找到碰撞器，则返回空
-}
 
-engine::component::TileType LevelLoader::get_tile_type(const nlohmann::json& tile_json) {
-    if (tile_json.contains("properties")) {
-        auto& properties = tile_json["properties"];
-        for (auto& property : properties) {
-            if (property.contains("name") && property["name"] == "solid") {
-                auto is_solid = property.value("value", false);
-                return is_solid ? engine::component::TileType::Solid : engine::component::TileType::Normal;
-            } else if (property.contains("name") && property["name"] == "slope") {
-                auto slope_type = property.value("value", "");
-                if (slope_type == "0_1") {
-                    return engine::component::TileType::Slope_0_1;
-                } else if (slope_type == "1_0") {
-                    return engine::component::TileType::Slope_1_0;
-                } else if (slope_type == "0_2") {
-                    return engine::component::TileType::Slope_0_2;
-                } else if (slope_type == "2_0") {
-                    return engine::component::TileType::Slope_2_0;
-                } else if (slope_type == "2_1") {
-                    return engine::component::TileType::Slope_2_1;
-                } else if (slope_type == "1_2") {
-                    return engine::component::TileType::Slope_1_2;
-                } else {
-                    spdlog::error("未知的斜坡类型: {}", slope_type);
-                    return engine::component::TileType::Normal;
-                }
-            } else if (property.contains("name") && property["name"] == "unisolid") {
-                auto is_unisolid = property.value("value", false);
-                return is_unisolid ? engine::component::TileType::Unisolid : engine::component::TileType::Normal;
-            } else if (property.contains("name") && property["name"] == "hazard") {
-                auto is_hazard = property.value("value", false);
-                return is_hazard ? engine::component::TileType::Hazard : engine::component::TileType::Normal;
-            } else if (property.contains("name") && property["name"] == "ladder") {
-                auto is_ladder = property.value("value", false);
-                return is_ladder ? engine::component::TileType::Ladder : engine::component::TileType::Normal;
-            }
-            // TODO: 可以在这里添加更多自定义属性处理逻辑
-        }
+    // --- 图块对象：从预制体克隆，不再构建动画或解析任何数据 ---
+    const auto& prefab = prefabs_[object.prototype];
+    const auto& prototype = *prefab.data;
+    if (!prototype.tag.empty()) game_object->set_tag(prototype.tag);
+    auto src_size = prefab.sprite.getGlobalBounds().size;
+    auto scale = object.size.componentWiseDiv(src_size);
+    game_object->add_component<engine::component::TransformComponent>(object.position, scale, sf::degrees(object.rotation));
+    game_object->add_component<engine::component::SpriteComponent>(sf::Sprite(prefab.sprite));
+
+    // 碰撞信息：SOLID类型的碰撞盒即图片源矩形；自定义碰撞盒的坐标相对于图片，也就是针对Transform的偏移量
+    if (prototype.collider == ColliderKind::Sprite) {
+        auto collider = std::make_unique<engine::physics::AABBCollider>(src_size);
+        game_object->add_component<engine::component::ColliderComponent>(std::move(collider));
+    } else if (prototype.collider == ColliderKind::Custom) {
+        auto collider = std::make_unique<engine::physics::AABBCollider>(prototype.collider_rect.size);
+        auto* cc = game_object->add_component<engine::component::ColliderComponent>(std::move(collider));
+        cc->set_offset(prototype.collider_rect.position);
     }
-    return engine::component::TileType::Normal;
-}
 
-engine::component::TileType LevelLoader::get_tile_type_by_id(const nlohmann::json& tileset_json, int local_id) {
-    if (tileset_json.contains("tiles")) {
-        auto& tiles = tileset_json["tiles"];
-        for (auto& tile : tiles) {
-            if (tile.contains("id") && tile["id"] == local_id) {
-                return get_tile_type(tile);
-            }
-        }
+    // 生命值
+    if (prototype.health) {
+        game_object->add_component<engine::component::HealthComponent>(prototype.health.value());
     }
-    return engine::component::TileType::Normal;
+    return game_object;
 }
 
-engine::component::TileInfo LevelLoader::get_tile_info_by_gid(int gid) {
-    sf::Sprite default_sprite(*context_.get_resource_manager().get_texture("assets/textures/Props/big-crate.png"));
-    auto default_tile_info = engine::component::TileInfo(default_sprite);
-
-    if (gid == 0) {
-        return default_tile_info;
+void LevelLoader::finish_object(const ObjectData& object, engine::object::GameObject& game_object, Scene& scene) const {
+    auto* physics_engine = &scene.get_context().get_physics_engine();
+    if (object.kind == ObjectData::Kind::Shape) {
+        // 添加物理组件，不受重力影响
+        game_object.add_component<engine::component::PhysicsComponent>(physics_engine, false);
+        return;
     }
 
-    // upper_bound：查找tileset_data_中键大于 gid 的第一个元素，返回迭代器
-    auto tileset_it = tileset_data_.upper_bound(gid);
-    if (tileset_it == tileset_data_.begin()) {
-        spdlog::error("gid为 {} 的瓦片未找到图块集。", gid);
-        return default_tile_info;
-    }
-    --tileset_it;  // 前移一个位置，这样就得到不大于gid的最近一个元素（我们需要的）
-
-    const auto& tileset = tileset_it->second;
-    auto local_id = gid - tileset_it->first;        // 计算瓦片在图块集中的局部ID
-    std::string file_path = tileset.value("file_path", "");       // 获取图块集文件路径
-    if (file_path.empty()) {
-        spdlog::error("Tileset 文件 '{}' 缺少 'file_path' 属性。", tileset_it->first);
-        return default_tile_info;
+    const auto& prefab = prefabs_[object.prototype];
+    const auto& prototype = *prefab.data;
+    // 有碰撞盒的对象需要物理组件；重力信息未设置时不受重力影响
+    if (prototype.collider != ColliderKind::None) {
+        game_object.add_component<engine::component::PhysicsComponent>(physics_engine, prototype.gravity.value_or(false));
+    } else if (prototype.gravity) {
+        spdlog::warn("对象 '{}' 在设置重力信息时没有物理组件，请检查地图设置。", object.name);
+        game_object.add_component<engine::component::PhysicsComponent>(physics_engine, prototype.gravity.value());
     }
 
-    // 图块集分为两种情况，需要分别考虑
-    if (tileset.contains("image")) {    // 这是单一图片的情况
-        // 获取图片路径
-        auto texture_id = resolve_path(tileset["image"].get<std::string>(), file_path);
-        // 计算瓦片在图片网格中的坐标
-        auto coordinate_x = local_id % tileset["columns"].get<int>();
-        auto coordinate_y = local_id / tileset["columns"].get<int>();
-        // 根据坐标确定源矩形
-        sf::IntRect texture_rect = {
-            {coordinate_x * tile_size_.x,
-            coordinate_y * tile_size_.y},
-            {tile_size_.x,
-            tile_size_.y}
-        };
-        sf::Sprite sprite{*context_.get_resource_manager().get_texture(texture_id), texture_rect};
-        auto tile_type = get_tile_type_by_id(tileset, local_id);
-        return engine::component::TileInfo(sprite, tile_type);
-    } else {   // 这是多图片的情况
-        if (!tileset.contains("tiles")) {   // 没有tiles字段的话不符合数据格式要求，直接返回空的瓦片信息
-            spdlog::error("Tileset 文件 '{}' 缺少 'tiles' 属性。", tileset_it->first);
-            return default_tile_info;
-        }
-        // 遍历tiles数组，根据id查找对应的瓦片
-        const auto& tiles_json = tileset["tiles"];
-        for (const auto& tile_json : tiles_json) {
-            auto tile_id = tile_json.value("id", 0);
-            if (tile_id == local_id) {   // 找到对应的瓦片，进行后续操作
-                if (!tile_json.contains("image")) {   // 没有image字段的话不符合数据格式要求，直接返回空的瓦片信息
-                    spdlog::error("Tileset 文件 '{}' 中瓦片 {} 缺少 'image' 属性。", tileset_it->first, tile_id);
-                    return default_tile_info;
-                }
-                // --- 接下来根据必要信息创建并返回 TileInfo ---
-                // 获取图片路径
-                auto texture_id = resolve_path(tile_json["image"].get<std::string>(), file_path);
-                // 先确认图片尺寸
-                auto image_width = tile_json.value("imagewidth", 0);
-                auto image_height = tile_json.value("imageheight", 0);
-                // 从json中获取源矩形信息
-                sf::IntRect texture_rect = {      // tiled中源矩形信息只有设置了才会有值，没有就是默认值
-                    {tile_json.value("x", 0),
-                    tile_json.value("y", 0)},
-                    {tile_json.value("width", image_width),    // 如果未设置，则使用图片尺寸
-                    tile_json.value("height", image_height)}
-                };
-                sf::Sprite sprite{*context_.get_resource_manager().get_texture(texture_id), texture_rect};
-                auto tile_type = get_tile_type(tile_json);      // 有了瓦片json，直接获取瓦片类型
-                return engine::component::TileInfo(sprite, tile_type);
-            }
+    // 动画（与同一原型的其它对象共享片段，由场景的动画系统推进）
+    if (!prefab.animations.empty()) {
+        auto* ac = game_object.add_component<engine::component::AnimationComponent>(&scene.get_animation_system());
+        for (const auto& animation : prefab.animations) {
+            ac->add_animation(animation);
         }
     }
-    // 如果能走到这里，说明查找失败，返回空的瓦片信息
-    spdlog::error("图块集 '{}' 中未找到gid为 {} 的瓦片。", tileset_it->first, gid);
-    return default_tile_info;
-}
 
-std::optional<nlohmann::json> LevelLoader::get_tile_json_by_gid(int gid) const {
-    // 1. 查找tileset_data_中键小于等于gid的最近元素
-    auto tileset_it = tileset_data_.upper_bound(gid);
-    if (tileset_it == tileset_data_.begin()) {
-        spdlog::error("gid为 {} 的瓦片未找到图块集。", gid);
-        return std::nullopt;
-    }
-    --tileset_it;
-    // 2. 获取图块集json对象
-    const auto& tileset = tileset_it->second;
-    auto local_id = gid - tileset_it->first;        // 计算瓦片在图块集中的局部ID
-    if (!tileset.contains("tiles")) {   // 没有tiles字段的话不符合数据格式要求，直接返回空
-        spdlog::error("Tileset 文件 '{}' 缺少 'tiles' 属性。", tileset_it->first);
-        return std::nullopt;
-    }
-    // 3. 遍历tiles数组，根据id查找对应的瓦片并返回瓦片json
-    const auto& tiles_json = tileset["tiles"];
-    for (const auto& tile_json : tiles_json) {
-        auto tile_id = tile_json.value("id", 0);
-        if (tile_id == local_id) {   // 找到对应的瓦片，返回瓦片json
-            return tile_json;
+    // 音效（句柄已在编译预制体时解析）
+    if (!prefab.sounds.empty()) {
+        auto* audio_component = game_object.add_component<engine::component::AudioComponent>(&scene.get_context().get_audio_player(), &scene.get_context().get_camera());
+        for (size_t i = 0; i < prefab.sounds.size(); ++i) {
+            audio_component->add_sound(prototype.sounds[i].id, prefab.sounds[i]);
         }
     }
-    return std::nullopt;
-}
-
-void LevelLoader::load_tileset(std::string_view tileset_path, int first_gid) {
-    auto path = std::filesystem::path(tileset_path);
-    std::ifstream tileset_file(path);
-    if (!tileset_file.is_open()) {
-        spdlog::error("无法打开 Tileset 文件: {}", tileset_path);
-        return;
-    }
-
-    nlohmann::json ts_json;
-    try {
-        tileset_file >> ts_json;
-    } catch (const nlohmann::json::parse_error& e) {
-        spdlog::error("解析 Tileset json 文件 ‘{}’ 失败：{} (at byte {})", tileset_path, e.what(), e.byte);
-        return;
-    }
-    ts_json["file_path"] = tileset_path;    // 将文件路径储存到json中，后续解析图片路径时需要
-    tileset_data_[first_gid] = std::move(ts_json);
-    spdlog::info("Tileset 文件 ‘{}’ 加载完成，firstgid：{}", tileset_path, first_gid);
-}
-
-std::string LevelLoader::resolve_path(std::string_view relative_path, std::string_view file_path) {
-    try {
-    // 获取地图文件的父目录（相对于可执行文件） "assets/maps/level1.tmj" -> "assets/maps"
-    auto map_dir = std::filesystem::path(file_path).parent_path();
-    // 合并路径（相对于可执行文件）并返回。 /* std::filesystem::canonical：解析路径中的当前目录（.）和上级目录（..）导航符，
-                                      /*  得到一个干净的路径 */
-    auto final_path = std::filesystem::canonical(map_dir / relative_path);
-    return final_path.string();
-    } catch (const std::exception& e) {
-        spdlog::error("解析路径失败: {}", e.what());
-        return std::string(relative_path);
-    }
 }
 } // namespace engine::scene
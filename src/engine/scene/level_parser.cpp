@@ -0,0 +1,448 @@
+#include "level_parser.hpp"
+#include "tilelayer_component.hpp"
+#include "layer_codec.hpp"
+#include "content_hash.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace engine::scene {
+namespace {
+/**
+ * @brief 流式读取 Tiled 地图的 SAX 处理器
+ *
+ * 除瓦片层（或无限地图区块）的 "data" 数组外，其余内容照常构建为 json（地图属性、图层信息、对象都很小）；
+ * "data" 数组中的 gid 直接追加到紧凑的 uint32_t 缓冲区，图层对象中只留下缓冲区下标（DATA_BUFFER_KEY），
+ * 不再为每个瓦片创建一个 json 节点。
+ * Tiled 按字母顺序输出键名，"tilesets" 位于 "layers" 之后，图层的 "visible" 也在 "data" 之后，
+ * 所以无法边读边解析瓦片，只能先把 gid 读入缓冲区，读完后再统一解析。
+ */
+class MapSaxHandler final : public nlohmann::json_sax<nlohmann::json> {
+public:
+    static constexpr std::string_view DATA_BUFFER_KEY = "$data_buffer";
+
+    explicit MapSaxHandler(std::vector<std::vector<uint32_t>>& tile_data)
+        : tile_data_{tile_data} {
+    }
+
+    nlohmann::json& get_root() { return root_; }
+
+    bool null() override { return add_value(nullptr); }
+    bool boolean(bool value) override { return add_value(value); }
+    bool number_integer(number_integer_t value) override {
+        if (capturing_) return capture(value);
+        return add_value(value);
+    }
+    bool number_unsigned(number_unsigned_t value) override {
+        if (capturing_) return capture(value);
+        return add_value(value);
+    }
+    bool number_float(number_float_t value, const string_t&) override { return !capturing_ && add_value(value); }
+    bool string(string_t& value) override { return !capturing_ && add_value(std::move(value)); }
+    bool binary(binary_t& value) override { return !capturing_ && add_value(nlohmann::json::binary(std::move(value))); }
+
+    bool start_object(std::size_t) override {
+        if (capturing_) return false;
+        push(add_value(nlohmann::json::object()));
+        return true;
+    }
+    bool key(string_t& value) override {
+        key_ = std::move(value);
+        return true;
+    }
+    bool end_object() override {
+        pop();
+        return true;
+    }
+
+    bool start_array(std::size_t) override {
+        if (capturing_) return false;
+        if (key_ == "data" && in_data_owner()) {    // 瓦片层/区块的 gid 数组：改为写入缓冲区
+            auto index = tile_data_.size();
+            tile_data_.emplace_back();
+            key_ = DATA_BUFFER_KEY;
+            add_value(index);
+            capturing_ = true;
+            return true;
+        }
+        push(add_value(nlohmann::json::array()));
+        return true;
+    }
+    bool end_array() override {
+        if (capturing_) {
+            capturing_ = false;
+            return true;
+        }
+        pop();
+        return true;
+    }
+
+    bool parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& e) override {
+        spdlog::error("解析 JSON 数据失败 (at byte {}): {}", position, e.what());
+        return false;
+    }
+
+private:
+    template<typename Value>
+    nlohmann::json* add_value(Value&& value) {
+        if (stack_.empty()) {
+            root_ = nlohmann::json(std::forward<Value>(value));
+            return &root_;
+        }
+        auto* parent = stack_.back().value;
+        if (parent->is_array()) {
+            parent->emplace_back(std::forward<Value>(value));
+            return &parent->back();
+        }
+        auto& slot = (*parent)[key_];
+        slot = nlohmann::json(std::forward<Value>(value));
+        return &slot;
+    }
+
+    template<typename Number>
+    bool capture(Number value) {
+        tile_data_.back().push_back(static_cast<uint32_t>(value));
+        return true;
+    }
+
+    void push(nlohmann::json* container) {
+        bool in_array = !stack_.empty() && stack_.back().value->is_array();
+        stack_.push_back({container, in_array ? std::string{} : key_});
+    }
+    void pop() {
+        if (!stack_.empty()) stack_.pop_back();
+    }
+
+    /// @brief 当前是否位于某个 "layers" 或 "chunks" 数组的元素（图层或区块对象）内
+    bool in_data_owner() const {
+        auto size = stack_.size();
+        if (size < 2 || !stack_[size - 1].value->is_object() || !stack_[size - 2].value->is_array()) return false;
+        const auto& array_key = stack_[size - 2].key;
+        return array_key == "layers" || array_key == "chunks";
+    }
+
+    struct Container {
+        nlohmann::json* value;
+        std::string key;                            ///< @brief 该容器在父对象中的键名（数组元素为空）
+    };
+
+    std::vector<std::vector<uint32_t>>& tile_data_;
+    nlohmann::json root_;
+    std::vector<Container> stack_;                  ///< @brief 正在构建的容器（object 基于 std::map，节点地址稳定）
+    std::string key_;                               ///< @brief 最近读到的键名
+    bool capturing_ = false;                        ///< @brief 是否正在读取 gid 数组
+};
+} // namespace
+
+LevelParser::LevelParser(FileReader read_file, TilesetRegistry& tilesets)
+    : read_file_{std::move(read_file)}
+    , tileset_registry_{tilesets} {
+}
+
+std::optional<LevelData> LevelParser::parse(std::string_view level_path) {
+    map_path_ = level_path;
+    tilesets_.clear();
+    gid_table_.clear();
+    texture_indices_.clear();
+    prototype_indices_.clear();
+    tile_data_.clear();
+
+    // 1、加载 json 文件
+    auto file = read_file_(level_path);
+    if (!file) {
+        spdlog::error("无法打开关卡文件: {}", level_path);
+        return std::nullopt;
+    }
+
+    // 2、流式解析 json 数据（瓦片 gid 直接进入缓冲区）
+    MapSaxHandler handler(tile_data_);
+    if (!nlohmann::json::sax_parse(file->text(), &handler)) {
+        spdlog::error("解析地图文件 '{}' 失败", level_path);
+        return std::nullopt;
+    }
+    const auto& json_data = handler.get_root();
+
+    // 3. 获取基本地图信息 (地图尺寸、瓦片尺寸、背景音乐)
+    LevelData level;
+    level.map_size = sf::Vector2i(json_data.value("width", 0), json_data.value("height", 0));
+    level.infinite = json_data.value("infinite", false);
+    level.tile_size = sf::Vector2i(json_data.value("tilewidth", 0), json_data.value("tileheight", 0));
+    level.music = Tileset::get_property<std::string>(json_data, "music").value_or("");
+    level.dependencies.push_back({engine::resource::AssetArchive::normalize_path(level_path), engine::utils::hash_content(file->bytes())});
+    intern_texture(std::string(DEFAULT_TEXTURE), level);       // 纹理表第 0 项
+
+    // 4. 加载 tileset 数据
+    if (json_data.contains("tilesets") && json_data["tilesets"].is_array()) {
+        for (const auto& tileset_json : json_data["tilesets"]) {
+            if (!tileset_json.contains("source") || !tileset_json["source"].is_string() ||
+                !tileset_json.contains("firstgid") || !tileset_json["firstgid"].is_number_integer()) {
+                spdlog::error("tilesets 对象中缺少有效 'source' 或 'firstgid' 字段。");
+                continue;
+            }
+            auto tileset_path = Tileset::resolve_path(tileset_json["source"].get<std::string>(), map_path_);
+            load_tileset(tileset_path, tileset_json["firstgid"].get<int>());
+        }
+    }
+    for (const auto& ref : tilesets_) {
+        level.dependencies.push_back({ref.tileset->path, ref.tileset->content_hash});
+    }
+
+    // 5、解析图层数据
+    if (!json_data.contains("layers") || !json_data["layers"].is_array()) {       // 地图文件中必须有 layers 数组
+        spdlog::error("地图文件 '{}' 中缺少或无效的 'layers' 数组。", level_path);
+        return std::nullopt;
+    }
+    for (const auto& layer_json : json_data["layers"]) {
+        std::string layer_type = layer_json.value("type", "none");
+        if (!layer_json.value("visible", true)) {
+            spdlog::info("图层 '{}' 不可见，跳过加载。", layer_json.value("name", "Unnamed"));
+            continue;
+        }
+
+        if (layer_type == "imagelayer") {
+            parse_image_layer(layer_json, level);
+        } else if (layer_type == "tilelayer") {
+            parse_tile_layer(layer_json, level);
+        } else if (layer_type == "objectgroup") {
+            parse_object_layer(layer_json, level);
+        } else {
+            spdlog::warn("不支持的图层类型: {}", layer_type);
+        }
+    }
+
+    tile_data_.clear();
+    return level;
+}
+
+void LevelParser::parse_image_layer(const nlohmann::json& layer_json, LevelData& level) {
+    std::string image_path = layer_json.value("image", "");
+    if (image_path.empty()) {
+        spdlog::error("图层 '{}' 缺少 'image' 属性。", layer_json.value("name", "Unnamed"));
+        return;
+    }
+
+    LayerData layer;
+    layer.type = LayerData::Type::Image;
+    layer.name = layer_json.value("name", "Unnamed");
+    layer.texture = intern_texture(Tileset::resolve_path(image_path, map_path_), level);
+    // json中没有则代表未设置，给默认值即可
+    layer.offset = sf::Vector2f(layer_json.value("offsetx", 0.f), layer_json.value("offsety", 0.f));
+    layer.scroll_factor = sf::Vector2f(layer_json.value("parallaxx", 1.f), layer_json.value("parallaxy", 1.f));
+    layer.repeat = sf::Vector2<bool>(layer_json.value("repeatx", false), layer_json.value("repeaty", false));
+    level.layers.push_back(std::move(layer));
+}
+
+void LevelParser::parse_tile_layer(const nlohmann::json& layer_json, LevelData& level) {
+    LayerData layer;
+    layer.type = LayerData::Type::Tile;
+    layer.name = layer_json.value("name", "Unnamed");
+
+    // 无限地图：瓦片按区块存储，每个区块各自带有坐标、尺寸与 "data"
+    if (layer_json.contains("chunks")) {
+        if (!layer_json["chunks"].is_array()) {
+            spdlog::error("图层 '{}' 的 'chunks' 属性无效。", layer.name);
+            return;
+        }
+        for (const auto& chunk_json : layer_json["chunks"]) {
+            ChunkData chunk;
+            chunk.position = sf::Vector2i(chunk_json.value("x", 0), chunk_json.value("y", 0));
+            chunk.size = sf::Vector2i(chunk_json.value("width", 0), chunk_json.value("height", 0));
+            std::vector<uint32_t> decoded;
+            auto data = get_tile_data(layer_json, chunk_json, decoded);
+            if (!data) return;
+            if (data->size() != static_cast<size_t>(std::max(chunk.size.x, 0)) * static_cast<size_t>(std::max(chunk.size.y, 0))) {
+                spdlog::error("图层 '{}' 中区块 ({}, {}) 的数据与区块尺寸不符。", layer.name, chunk.position.x, chunk.position.y);
+                return;
+            }
+            chunk.tiles.reserve(data->size());
+            for (auto gid : data.value()) {
+                chunk.tiles.push_back(resolve_tile(static_cast<int>(gid), level));
+            }
+            layer.chunks.push_back(std::move(chunk));
+        }
+        level.layers.push_back(std::move(layer));
+        return;
+    }
+
+    std::vector<uint32_t> decoded;
+    auto data = get_tile_data(layer_json, layer_json, decoded);
+    if (!data) return;
+    layer.tiles.reserve(data->size());
+    for (auto gid : data.value()) {
+        layer.tiles.push_back(resolve_tile(static_cast<int>(gid), level));
+    }
+    level.layers.push_back(std::move(layer));
+}
+
+std::optional<std::span<const uint32_t>> LevelParser::get_tile_data(const nlohmann::json& layer_json
+                                                                  , const nlohmann::json& data_json
+                                                                  , std::vector<uint32_t>& decoded) const {
+    // gid 数组已由 SAX 处理器读入缓冲区；base64 编码的数据在这里解码（并解压）到 decoded
+    if (auto buffer = data_json.value(MapSaxHandler::DATA_BUFFER_KEY, SIZE_MAX); buffer < tile_data_.size()) {
+        return tile_data_[buffer];
+    }
+    if (data_json.contains("data") && data_json["data"].is_string()) {
+        if (!decode_tile_data(layer_json, data_json, decoded)) return std::nullopt;
+        return decoded;
+    }
+    spdlog::error("图层 '{}' 缺少 'data' 属性。", layer_json.value("name", "Unnamed"));
+    return std::nullopt;
+}
+
+bool LevelParser::decode_tile_data(const nlohmann::json& layer_json, const nlohmann::json& data_json, std::vector<uint32_t>& gids) const {
+    auto layer_name = layer_json.value("name", "Unnamed");
+    if (auto encoding = layer_json.value("encoding", "csv"); encoding != "base64") {
+        spdlog::error("图层 '{}' 的编码 '{}' 不受支持。", layer_name, encoding);
+        return false;
+    }
+    auto compression = engine::utils::parse_layer_compression(layer_json.value("compression", ""));
+    if (!compression) {
+        spdlog::error("图层 '{}' 的压缩方式 '{}' 不受支持。", layer_name, layer_json.value("compression", ""));
+        return false;
+    }
+
+    auto count = static_cast<size_t>(std::max(data_json.value("width", 0), 0)) * static_cast<size_t>(std::max(data_json.value("height", 0), 0));
+    gids.resize(count);
+    const auto& text = data_json["data"].get_ref<const std::string&>();
+    if (!engine::utils::decode_layer_data(text, compression.value(), gids)) {
+        spdlog::error("图层 '{}' 的数据解码失败（数据损坏或与图层尺寸不符）。", layer_name);
+        return false;
+    }
+    return true;
+}
+
+std::optional<uint32_t> LevelParser::get_prototype(int gid, LevelData& level) {
+    if (auto it = prototype_indices_.find(gid); it != prototype_indices_.end()) return it->second;
+
+    const auto* tile = find_tile(gid);
+    if (tile && !tile->properties_valid) {
+        prototype_indices_.emplace(gid, std::nullopt);
+        return std::nullopt;
+    }
+
+    PrototypeData prototype;
+    prototype.source = get_tile_source(gid);
+    prototype.tile = resolve_tile(gid, level);
+    // 碰撞信息：SOLID类型的碰撞盒即图片源矩形；否则检查自定义碰撞盒
+    if (prototype.tile.type == engine::component::TileType::Solid) {
+        prototype.collider = ColliderKind::Sprite;
+    } else if (tile && tile->collider_rect) {
+        prototype.collider = ColliderKind::Custom;
+        prototype.collider_rect = tile->collider_rect.value();
+    }
+
+    // 标签：手动设置优先，其次SOLID为"solid"、危险瓦片为"hazard"
+    if (tile && tile->tag) {
+        prototype.tag = tile->tag.value();
+    } else if (prototype.tile.type == engine::component::TileType::Solid) {
+        prototype.tag = "solid";
+    } else if (prototype.tile.type == engine::component::TileType::Hazard) {
+        prototype.tag = "hazard";
+    }
+
+    if (tile) {
+        prototype.gravity = tile->gravity;
+        prototype.health = tile->health;
+        prototype.animations = tile->animations;
+        prototype.sounds = tile->sounds;
+    }
+
+    auto index = static_cast<uint32_t>(level.prototypes.size());
+    level.prototypes.push_back(std::move(prototype));
+    prototype_indices_.emplace(gid, index);
+    return index;
+}
+
+void LevelParser::parse_object_layer(const nlohmann::json& layer_json, LevelData& level) {
+    if (!layer_json.contains("objects") || !layer_json["objects"].is_array()) {
+        spdlog::error("对象图层 '{}' 缺少 'objects' 属性。", layer_json.value("name", "Unnamed"));
+        return;
+    }
+
+    LayerData layer;
+    layer.type = LayerData::Type::Object;
+    layer.name = layer_json.value("name", "Unnamed");
+    for (const auto& object : layer_json["objects"]) {
+        ObjectData data;
+        data.name = object.value("name", "Unnamed");
+        data.position = sf::Vector2f(object.value("x", 0.f), object.value("y", 0.f));
+        data.size = sf::Vector2f(object.value("width", 0.f), object.value("height", 0.f));
+        data.rotation = object.value("rotation", 0.f);
+
+        auto gid = object.value("gid", 0);
+        if (gid == 0) {    // gid为0代表自己绘制的形状（碰撞盒、触发器）
+            // 非矩形对象会有额外标识（目前不考虑）
+            if (object.value("point", false) || object.value("ellipse", false) || object.value("polygon", false)) {
+                continue;       // TODO: 点、椭圆、多边形对象的处理方式
+            }
+            data.kind = ObjectData::Kind::Shape;
+            data.trigger = object.value("trigger", true);   // 自定义形状通常是trigger类型，除非显示指定
+            data.tag = Tileset::get_property<std::string>(object, "tag").value_or("");
+            layer.objects.push_back(std::move(data));
+            continue;
+        }
+
+        auto prototype = get_prototype(gid, level);
+        if (!prototype) continue;   // 动画或音效属性有误，跳过此对象
+        data.kind = ObjectData::Kind::Tile;
+        data.prototype = prototype.value();
+        data.position.y -= data.size.y;     // 图块对象的坐标针对左下角，调整为左上角
+        layer.objects.push_back(std::move(data));
+    }
+    level.layers.push_back(std::move(layer));
+}
+
+TileData LevelParser::resolve_tile(int gid, LevelData& level) {
+    if (gid == 0) return {};    // 默认纹理、整张图片、空白类型
+    if (gid < 0 || static_cast<size_t>(gid) >= gid_table_.size() || !gid_table_[gid].tile) {
+        spdlog::error("gid为 {} 的瓦片未找到图块集。", gid);
+        return {};
+    }
+
+    const auto& entry = gid_table_[gid];
+    auto& ref = tilesets_[entry.tileset];
+    auto& texture = ref.texture_indices[entry.tile->texture];
+    if (texture == UINT32_MAX) {    // 只登记实际用到的图片，图块集中未使用的图片不会进入纹理表
+        texture = intern_texture(ref.tileset->textures[entry.tile->texture], level);
+    }
+    return {texture, entry.tile->rect, entry.tile->type};
+}
+
+std::string LevelParser::get_tile_source(int gid) const {
+    if (gid <= 0 || static_cast<size_t>(gid) >= gid_table_.size() || !gid_table_[gid].tile) return {};
+    const auto& entry = gid_table_[gid];
+    const auto& tileset = *tilesets_[entry.tileset].tileset;
+    return tileset.path + "#" + std::to_string(entry.tile - tileset.tiles.data());
+}
+
+const TileDefinition* LevelParser::find_tile(int gid) const {
+    if (gid <= 0 || static_cast<size_t>(gid) >= gid_table_.size()) return nullptr;
+    return gid_table_[gid].tile;
+}
+
+uint32_t LevelParser::intern_texture(std::string path, LevelData& level) {
+    if (auto it = texture_indices_.find(path); it != texture_indices_.end()) return it->second;
+    auto index = static_cast<uint32_t>(level.textures.size());
+    level.textures.push_back(path);
+    texture_indices_.emplace(std::move(path), index);
+    return index;
+}
+
+bool LevelParser::load_tileset(std::string_view tileset_path, int first_gid) {
+    auto tileset = tileset_registry_.get(tileset_path, read_file_);
+    if (!tileset) return false;
+
+    // 展开到 gid 表：gid = firstgid + 局部 id
+    auto tileset_index = static_cast<uint32_t>(tilesets_.size());
+    auto& ref = tilesets_.emplace_back(std::move(tileset), std::vector<uint32_t>{});
+    ref.texture_indices.assign(ref.tileset->textures.size(), UINT32_MAX);
+    const auto& tiles = ref.tileset->tiles;
+    gid_table_.resize(std::max(gid_table_.size(), first_gid + tiles.size()));
+    for (size_t local_id = 0; local_id < tiles.size(); ++local_id) {
+        if (tiles[local_id].valid) gid_table_[first_gid + local_id] = {tileset_index, &tiles[local_id]};
+    }
+    return true;
+}
+} // namespace engine::scene
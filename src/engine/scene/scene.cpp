@@ -4,34 +4,89 @@
 #include "game_object.hpp"
 #include "game_state.hpp"
 #include "physics_engine.hpp"
+#include "render.hpp"
+#include "resource_manager.hpp"
 #include "scene_manager.hpp"
+#include "tilelayer_component.hpp"
 #include "ui_manager.hpp"
 #include <spdlog/spdlog.h>
 
 namespace engine::scene {
+namespace {
+constexpr auto LOADING_UPLOAD_BUDGET = sf::milliseconds(8);     ///< @brief 加载阶段每次更新的纹理上传预算（仍留出时间绘制进度条、处理窗口事件）
+} // namespace
+
 Scene::Scene(std::string_view name, engine::core::Context& context, SceneManager& scene_manager)
     : scene_name_{name}
     , context_{context}
     , scene_manager_{scene_manager}
-    , ui_manager_{std::make_unique<ui::UIManager>(context_.get_game_state().get_logical_size())} {
+    , ui_manager_{std::make_unique<ui::UIManager>(context_.get_game_state().get_logical_size())}
+    , residency_scope_{context_.get_resource_manager().begin_residency_scope()}
+    , object_arena_{std::make_unique<engine::object::ObjectArena>(scene_name_)}
+    , animation_system_{std::make_unique<engine::render::AnimationSystem>()} {
     spdlog::trace("场景 ‘{}’ 初始化完成", scene_name_);
 }
 
-Scene::~Scene() = default;
+Scene::~Scene() {
+    // 先销毁对象与 UI（其中的精灵等仍引用着资源），再释放驻留作用域
+    loading_.reset();
+    pending_additions_.clear();
+    game_objects_.clear();
+    ui_manager_.reset();
+    context_.get_resource_manager().release_residency_scope(residency_scope_);
+}
+
+void Scene::enter() {
+    engine::resource::ResourceManifest manifest;
+    collect_resources(manifest);
+    if (manifest.empty()) {
+        init();
+        return;
+    }
+    spdlog::debug("场景 '{}' 开始加载 {} 个资源", scene_name_, manifest.size());
+    loading_ = std::make_unique<engine::resource::PreloadBatch>(context_.get_resource_manager().begin_preload(manifest));
+}
+
+void Scene::update_loading() {
+    if (!loading_) return;
+    context_.get_resource_manager().poll_preload(*loading_, LOADING_UPLOAD_BUDGET);
+    if (!loading_->is_done()) return;
+
+    if (loading_->failed > 0) {
+        spdlog::warn("场景 '{}' 有 {} 个资源预加载失败", scene_name_, loading_->failed);
+    }
+    spdlog::info("场景 '{}' 预加载完成：{} 个资源", scene_name_, loading_->total);
+    loading_.reset();
+    init();
+}
+
+void Scene::render_loading() {
+    if (!loading_) return;
+    auto& renderer = context_.get_renderer();
+    auto& camera = context_.get_camera();
+
+    // 屏幕中央的进度条：底框 + 按进度填充
+    auto view_size = camera.get_ui_view_size();
+    sf::FloatRect frame{{view_size.x * 0.25f, view_size.y * 0.5f - 4.f}, {view_size.x * 0.5f, 8.f}};
+    auto progress = loading_->total > 0 ? static_cast<float>(loading_->loaded) / static_cast<float>(loading_->total) : 1.f;
+    sf::FloatRect fill{frame.position, {frame.size.x * progress, frame.size.y}};
+    renderer.draw_ui_filled_rect(camera, frame, sf::Color(255, 255, 255, 60));
+    renderer.draw_ui_filled_rect(camera, fill, sf::Color::White);
+}
 
 void Scene::update(sf::Time delta) {
-    // 更新所有游戏对象，先略过需要移除的对象
+    remove_pending_objects();       // 上一帧标记移除的对象在这里统一移除，更新过程中容器不会变化
+
+    // 更新所有游戏对象，略过本帧新标记移除的对象
     for (auto& obj : game_objects_) {
-        if (obj && !obj->is_need_remove()) {
+        if (!obj->is_need_remove()) {
             obj->update(delta, context_);
-        } else {
-            if (!obj) spdlog::warn("尝试更新一个空的游戏对象指针。");
-            std::erase_if(game_objects_, [](const std::unique_ptr<engine::object::GameObject>& obj) {
-                return !obj || obj->is_need_remove();
-            });
         }
     }
 
+    // 批量推进场景中所有正在播放的动画
+    animation_system_->update(delta, context_);
+
     // 只有游戏进行中，才需要更新物理引擎和相机
     if (context_.get_game_state().is_playing()){
         context_.get_physics_engine().update(delta);
@@ -66,9 +121,29 @@ void Scene::handle_input() {
     }
 }
 
+void Scene::on_asset_changed(std::string_view path) {
+    const auto* texture = context_.get_resource_manager().find_texture(path);
+    if (!texture) return;
+    for (const auto& obj : game_objects_) {
+        auto* tile_layer = obj ? obj->get_component<engine::component::TileLayerComponent>() : nullptr;
+        if (tile_layer && tile_layer->uses_texture(texture)) {
+            tile_layer->invalidate_cache();
+            spdlog::debug("纹理 '{}' 已变化，重建瓦片层 '{}' 的缓存", path, obj->get_name());
+        }
+    }
+}
+
+std::unique_ptr<engine::object::GameObject> Scene::create_game_object(std::string_view name, std::string_view tag) {
+    return engine::object::GameObject::create(*object_arena_, name, tag);
+}
+
 void Scene::add_game_object(std::unique_ptr<engine::object::GameObject>&& game_object) {
-    if (game_object) game_objects_.push_back(std::move(game_object));
-    else spdlog::warn("尝试向场景 '{}' 添加空游戏对象。", scene_name_);
+    if (!game_object) {
+        spdlog::warn("尝试向场景 '{}' 添加空游戏对象。", scene_name_);
+        return;
+    }
+    register_object(*game_object, static_cast<uint32_t>(game_objects_.size()));
+    game_objects_.push_back(std::move(game_object));
 }
 
 void Scene::safe_add_game_object(std::unique_ptr<engine::object::GameObject>&& game_object) {
@@ -81,38 +156,39 @@ void Scene::remove_game_object(engine::object::GameObject* game_object_ptr) {
         spdlog::warn("尝试从场景 '{}' 中移除一个空的游戏对象指针。", scene_name_);
         return;
     }
-
-    // erase-remove 移除法不可用，因为智能指针与裸指针无法比较
-    // 需要使用 std::remove_if 和 lambda 表达式自定义比较的方式
-    auto it = std::remove_if(game_objects_.begin(), game_objects_.end(),
-                             [game_object_ptr](const std::unique_ptr<engine::object::GameObject>& p) {
-                                 return p.get() == game_object_ptr;    // 比较裸指针是否相等（自定义比较方式）
-                             });
-
-    if (it != game_objects_.end()) {
-        game_objects_.erase(it, game_objects_.end());   // 删除从it到末尾的元素（最后一个元素）
-        spdlog::trace("从场景 '{}' 中移除游戏对象。", scene_name_);
-    } else {
+    if (get_game_object(game_object_ptr->get_handle()) != game_object_ptr) {
         spdlog::warn("游戏对象指针未找到在场景 '{}' 中。", scene_name_);
+        return;
+    }
+
+    // 句柄直接给出下标；保持其余对象的顺序（即渲染顺序），后面的对象依次前移并更新槽位，因此单次移除是 O(n)
+    auto position = object_slots_[game_object_ptr->get_handle().get_index()].position;
+    unregister_object(*game_object_ptr);
+    game_objects_.erase(game_objects_.begin() + position);
+    for (auto i = position; i < game_objects_.size(); ++i) {
+        object_slots_[game_objects_[i]->get_handle().get_index()].position = static_cast<uint32_t>(i);
     }
+    spdlog::trace("从场景 '{}' 中移除游戏对象。", scene_name_);
 }
 
 void Scene::safe_remove_game_object(engine::object::GameObject* game_object_ptr) {
     game_object_ptr->set_need_remove(true);
 }
 
+engine::object::GameObject* Scene::get_game_object(engine::object::GameObjectHandle handle) const {
+    if (!handle.is_valid() || handle.get_index() >= object_slots_.size()) return nullptr;
+    const auto& slot = object_slots_[handle.get_index()];
+    return slot.generation == handle.get_generation() ? slot.object : nullptr;
+}
+
 const std::vector<std::unique_ptr<engine::object::GameObject>>& Scene::get_game_objects() const {
     return game_objects_;
 }
 
 engine::object::GameObject* Scene::find_game_object_by_name(std::string_view name) const {
-        // 找到第一个符合条件的游戏对象就返回
-    for (const auto& obj : game_objects_) {
-        if (obj && obj->get_name() == name) {
-            return obj.get();
-        }
-    }
-    return nullptr;
+    // 索引中同名对象按加入场景的顺序排列，第一个即最早加入的对象
+    auto it = name_index_.find(name);
+    return it != name_index_.end() ? it->second.front() : nullptr;
 }
 
 void Scene::process_pending_additions() {
@@ -122,4 +198,88 @@ void Scene::process_pending_additions() {
     }
     pending_additions_.clear();
 }
-} // namespace engine::scene
\ No newline at end of file
+
+void Scene::remove_pending_objects() {
+    // 单次遍历压实容器：移除的对象回收句柄后销毁，保留的对象按原顺序前移并更新句柄表中的下标
+    size_t write = 0;
+    for (size_t read = 0; read < game_objects_.size(); ++read) {
+        auto& obj = game_objects_[read];
+        if (obj->is_need_remove()) {
+            unregister_object(*obj);
+            obj.reset();
+            continue;
+        }
+        if (write != read) {
+            object_slots_[obj->get_handle().get_index()].position = static_cast<uint32_t>(write);
+            game_objects_[write] = std::move(obj);
+        }
+        ++write;
+    }
+    game_objects_.resize(write);
+}
+
+void Scene::register_object(engine::object::GameObject& game_object, uint32_t position) {
+    uint32_t index = 0;
+    if (!free_object_slots_.empty()) {
+        index = free_object_slots_.back();
+        free_object_slots_.pop_back();
+    } else {
+        index = static_cast<uint32_t>(object_slots_.size());
+        object_slots_.emplace_back();
+    }
+    auto& slot = object_slots_[index];
+    slot.object = &game_object;
+    slot.position = position;
+    game_object.handle_ = {index, slot.generation};
+    game_object.scene_obs_ = this;
+    index_object(game_object);
+}
+
+void Scene::unregister_object(engine::object::GameObject& game_object) {
+    auto index = game_object.get_handle().get_index();
+    auto& slot = object_slots_[index];
+    slot.object = nullptr;
+    ++slot.generation;              // 旧句柄从此失效
+    free_object_slots_.push_back(index);
+    unindex_object(game_object);
+    game_object.handle_ = {};
+    game_object.scene_obs_ = nullptr;
+}
+
+void Scene::index_object(engine::object::GameObject& game_object) {
+    if (!game_object.get_name().empty()) {
+        auto it = name_index_.find(game_object.get_name());
+        if (it == name_index_.end()) it = name_index_.emplace(std::string(game_object.get_name()), std::vector<engine::object::GameObject*>{}).first;
+        it->second.push_back(&game_object);
+    }
+    if (!game_object.get_tag().empty()) {
+        auto it = tag_index_.find(game_object.get_tag());
+        if (it == tag_index_.end()) it = tag_index_.emplace(std::string(game_object.get_tag()), std::vector<engine::object::GameObject*>{}).first;
+        object_slots_[game_object.get_handle().get_index()].tag_position = static_cast<uint32_t>(it->second.size());
+        it->second.push_back(&game_object);
+    }
+}
+
+void Scene::unindex_object(engine::object::GameObject& game_object) {
+    // 列表为空时删除键，避免索引随名称种类无限增长
+    if (!game_object.get_name().empty()) {
+        // 名称索引保持先后顺序：find_game_object_by_name 返回最早加入的同名对象
+        if (auto it = name_index_.find(game_object.get_name()); it != name_index_.end()) {
+            std::erase(it->second, &game_object);
+            if (it->second.empty()) name_index_.erase(it);
+        }
+    }
+    if (!game_object.get_tag().empty()) {
+        // 标签索引不要求顺序：用记录的下标与末尾交换后弹出，同标签对象很多时移除也是 O(1)
+        if (auto it = tag_index_.find(game_object.get_tag()); it != tag_index_.end()) {
+            auto& objects = it->second;
+            auto position = object_slots_[game_object.get_handle().get_index()].tag_position;
+            auto* last = objects.back();
+            objects[position] = last;
+            object_slots_[last->get_handle().get_index()].tag_position = position;
+            objects.pop_back();
+            if (objects.empty()) tag_index_.erase(it);
+        }
+    }
+}
+} // namespace engine::scene
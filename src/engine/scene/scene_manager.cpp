@@ -1,6 +1,7 @@
 #include "scene_manager.hpp"
 #include "context.hpp"
 #include "scene.hpp"
+#include "resource_manager.hpp"
 #include <spdlog/spdlog.h>
 
 namespace engine::scene {
@@ -34,6 +35,13 @@ Scene* SceneManager::get_current_scene() const {
     return scene_stack_.back().get(); // 返回栈顶场景的裸指针
 }
 
+void SceneManager::on_asset_changed(std::string_view path) {
+    // 被覆盖的场景（例如暂停菜单下的游戏场景）也可能使用变化的纹理，因此通知所有场景
+    for (const auto& scene : scene_stack_) {
+        if (scene) scene->on_asset_changed(path);
+    }
+}
+
 engine::core::Context& SceneManager::get_context() const {
     return this->context_;
 }
@@ -42,7 +50,11 @@ void SceneManager::update(sf::Time delta_time) {
     // 只更新栈顶（当前）场景
     Scene* current_scene = get_current_scene();
     if (current_scene) {
-        current_scene->update(delta_time);
+        if (current_scene->is_loading()) {
+            current_scene->update_loading();    // 加载阶段：推进预加载，完成后场景自行初始化
+        } else {
+            current_scene->update(delta_time);
+        }
     }
     // 执行可能的切换场景操作
     process_pending_actions();
@@ -51,7 +63,10 @@ void SceneManager::update(sf::Time delta_time) {
 void SceneManager::render() {
     // 渲染时需要叠加渲染所有场景，而不只是栈顶
     for (const auto& scene : scene_stack_) {
-        if (scene) {
+        if (!scene) continue;
+        if (scene->is_loading()) {
+            scene->render_loading();
+        } else {
             scene->render();
         }
     }
@@ -60,7 +75,7 @@ void SceneManager::render() {
 void SceneManager::handle_input() {
     // 只考虑栈顶场景
     Scene* current_scene = get_current_scene();
-    if (current_scene) {
+    if (current_scene && !current_scene->is_loading()) {    // 加载阶段不处理输入
         current_scene->handle_input();
     }
 }
@@ -94,8 +109,10 @@ void SceneManager::push_scene(std::unique_ptr<Scene>&& scene) {
     }
     spdlog::debug("正在将场景 '{}' 压入栈。", scene->get_name());
 
-    // 将新场景移入栈顶
+    // 将新场景移入栈顶，激活它的驻留作用域后再进入，加载阶段与初始化期间加载的资源计入新场景
     scene_stack_.push_back(std::move(scene));
+    activate_top_residency_scope();
+    scene_stack_.back()->enter();
 }
 
 void SceneManager::pop_scene() {
@@ -105,8 +122,9 @@ void SceneManager::pop_scene() {
     }
     spdlog::debug("正在从栈中弹出场景 '{}' 。", scene_stack_.back()->get_name());
 
-    // 清理并移除栈顶场景
+    // 销毁栈顶场景（析构时释放其驻留作用域）
     scene_stack_.pop_back();
+    activate_top_residency_scope();
 }
 
 void SceneManager::replace_scene(std::unique_ptr<Scene>&& scene) {
@@ -116,12 +134,21 @@ void SceneManager::replace_scene(std::unique_ptr<Scene>&& scene) {
     }
     spdlog::debug("正在用场景 '{}' 替换场景 '{}' 。", scene->get_name(), scene_stack_.back()->get_name());
 
-    // 清理并移除场景栈中所有场景
-    while (!scene_stack_.empty()) {
-        scene_stack_.pop_back();
+    // 先进入新场景，再销毁旧场景：新场景已引用了清单中的资源，共用的资源不会在切换时被卸载又重新加载
+    auto old_scenes = std::move(scene_stack_);
+    scene_stack_.clear();
+    scene_stack_.push_back(std::move(scene));
+    activate_top_residency_scope();
+    scene_stack_.back()->enter();
+
+    // 从栈顶开始销毁旧场景（析构时释放各自的驻留作用域）
+    while (!old_scenes.empty()) {
+        old_scenes.pop_back();
     }
+}
 
-    // 将新场景压入栈顶
-    scene_stack_.push_back(std::move(scene));
+void SceneManager::activate_top_residency_scope() {
+    auto scope = scene_stack_.empty() ? 0u : scene_stack_.back()->get_residency_scope();
+    context_.get_resource_manager().set_active_residency_scope(scope);
 }
 } // namespace engine::scene
\ No newline at end of file
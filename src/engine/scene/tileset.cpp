@@ -0,0 +1,225 @@
+#include "tileset.hpp"
+#include "tilelayer_component.hpp"
+#include <spdlog/spdlog.h>
+#include <filesystem>
+
+namespace engine::scene {
+namespace {
+std::optional<sf::FloatRect> get_collider_rect(const nlohmann::json& tile_json) {
+    if (!tile_json.contains("objectgroup")) return std::nullopt;
+    auto& objectgroup = tile_json["objectgroup"];
+    if (!objectgroup.contains("objects")) return std::nullopt;
+    for (const auto& object : objectgroup["objects"]) {    // 一个图片只支持一个碰撞器。如果有多个，则返回第一个不为空的
+        auto rect = sf::FloatRect(sf::Vector2f(object.value("x", 0.f), object.value("y", 0.f)),
+                                  sf::Vector2f(object.value("width", 0.f), object.value("height", 0.f)));
+        if (rect.size.x > 0 && rect.size.y > 0) {
+            return rect;
+        }
+    }
+    return std::nullopt;    // 如果没找到碰撞器，则返回空
+}
+
+engine::component::TileType get_tile_type(const nlohmann::json& tile_json) {
+    if (tile_json.contains("properties")) {
+        auto& properties = tile_json["properties"];
+        for (auto& property : properties) {
+            if (property.contains("name") && property["name"] == "solid") {
+                auto is_solid = property.value("value", false);
+                return is_solid ? engine::component::TileType::Solid : engine::component::TileType::Normal;
+            } else if (property.contains("name") && property["name"] == "slope") {
+                auto slope_type = property.value("value", "");
+                if (slope_type == "0_1") {
+                    return engine::component::TileType::Slope_0_1;
+                } else if (slope_type == "1_0") {
+                    return engine::component::TileType::Slope_1_0;
+                } else if (slope_type == "0_2") {
+                    return engine::component::TileType::Slope_0_2;
+                } else if (slope_type == "2_0") {
+                    return engine::component::TileType::Slope_2_0;
+                } else if (slope_type == "2_1") {
+                    return engine::component::TileType::Slope_2_1;
+                } else if (slope_type == "1_2") {
+                    return engine::component::TileType::Slope_1_2;
+                } else {
+                    spdlog::error("未知的斜坡类型: {}", slope_type);
+                    return engine::component::TileType::Normal;
+                }
+            } else if (property.contains("name") && property["name"] == "unisolid") {
+                auto is_unisolid = property.value("value", false);
+                return is_unisolid ? engine::component::TileType::Unisolid : engine::component::TileType::Normal;
+            } else if (property.contains("name") && property["name"] == "hazard") {
+                auto is_hazard = property.value("value", false);
+                return is_hazard ? engine::component::TileType::Hazard : engine::component::TileType::Normal;
+            } else if (property.contains("name") && property["name"] == "ladder") {
+                auto is_ladder = property.value("value", false);
+                return is_ladder ? engine::component::TileType::Ladder : engine::component::TileType::Normal;
+            }
+            // TODO: 可以在这里添加更多自定义属性处理逻辑
+        }
+    }
+    return engine::component::TileType::Normal;
+}
+
+/**
+ * @brief 解析动画 json（自定义格式：动画名 -> {duration, row, frames}）
+ * @param sprite_size 每一帧的尺寸
+ */
+std::vector<AnimationData> parse_animations(const nlohmann::json& anim_json, sf::Vector2i sprite_size) {
+    std::vector<AnimationData> animations;
+    if (!anim_json.is_object()) {
+        spdlog::error("无效的动画 JSON。");
+        return animations;
+    }
+    // 遍历动画 JSON 对象中的每个键值对（动画名称 : 动画信息）
+    for (const auto& anim : anim_json.items()) {
+        const auto& anim_name = anim.key();
+        const auto& anim_info = anim.value();
+        if (!anim_info.is_object()) {
+            spdlog::warn("动画 '{}' 的信息无效或为空。", anim_name);
+            continue;
+        }
+        auto duration = static_cast<float>(anim_info.value("duration", 100)) / 1000.f;   // 默认100毫秒，转换为秒
+        auto row = anim_info.value("row", 0);                                           // 默认行数为0
+        // 帧信息（数组）是必须存在的
+        if (!anim_info.contains("frames") || !anim_info["frames"].is_array()) {
+            spdlog::warn("动画 '{}' 缺少 'frames' 数组。", anim_name);
+            continue;
+        }
+
+        AnimationData animation{anim_name, {}};
+        for (const auto& frame : anim_info["frames"]) {
+            if (!frame.is_number_integer()) {
+                spdlog::warn("动画 {} 中 frames 数组格式错误！", anim_name);
+                continue;
+            }
+            auto column = frame.get<int>();
+            animation.frames.push_back({{{column * sprite_size.x, row * sprite_size.y}, sprite_size}, duration});
+        }
+        animations.push_back(std::move(animation));
+    }
+    return animations;
+}
+
+/// @brief 解析音效 json（自定义格式：音效 id -> 路径）
+std::vector<SoundData> parse_sounds(const nlohmann::json& sound_json) {
+    std::vector<SoundData> sounds;
+    if (!sound_json.is_object()) {
+        spdlog::error("无效的音效 JSON。");
+        return sounds;
+    }
+    // 遍历音效 JSON 对象中的每个键值对（音效id : 音效路径）
+    for (const auto& sound : sound_json.items()) {
+        const auto& sound_id = sound.key();
+        std::string sound_path = sound.value().is_string() ? sound.value().get<std::string>() : "";
+        if (sound_id.empty() || sound_path.empty()) {
+            spdlog::warn("音效 '{}' 缺少必要信息。", sound_id);
+            continue;
+        }
+        sounds.push_back({sound_id, std::move(sound_path)});
+    }
+    return sounds;
+}
+
+/// @brief 读取瓦片 json 中的类型、碰撞盒与自定义属性
+void parse_tile_properties(const nlohmann::json& tile_json, TileDefinition& tile) {
+    tile.type = get_tile_type(tile_json);
+    tile.collider_rect = get_collider_rect(tile_json);
+    tile.tag = Tileset::get_property<std::string>(tile_json, "tag");
+    tile.gravity = Tileset::get_property<bool>(tile_json, "gravity");
+    tile.health = Tileset::get_property<int>(tile_json, "health");
+
+    // 动画与音效以 JSON 字符串形式储存在自定义属性中
+    if (auto anim_string = Tileset::get_property<std::string>(tile_json, "animation"); anim_string) {
+        try {
+            tile.animations = parse_animations(nlohmann::json::parse(anim_string.value()), tile.rect.size);
+        } catch (const nlohmann::json::parse_error& e) {
+            spdlog::error("解析动画 JSON 字符串失败: {}", e.what());
+            tile.properties_valid = false;
+        }
+    }
+    if (auto sound_string = Tileset::get_property<std::string>(tile_json, "sound"); sound_string) {
+        try {
+            tile.sounds = parse_sounds(nlohmann::json::parse(sound_string.value()));
+        } catch (const nlohmann::json::parse_error& e) {
+            spdlog::error("解析音效 JSON 字符串失败: {}", e.what());
+            tile.properties_valid = false;
+        }
+    }
+}
+} // namespace
+
+std::optional<Tileset> Tileset::parse(const nlohmann::json& tileset_json, std::string_view tileset_path) {
+    Tileset tileset;
+    tileset.path = tileset_path;
+    const auto empty_tiles = nlohmann::json::array();
+    const auto& tiles_json = tileset_json.contains("tiles") ? tileset_json["tiles"] : empty_tiles;
+
+    // 图块集分为两种情况，需要分别考虑
+    if (tileset_json.contains("image")) {    // 单一图片：所有瓦片按网格排列在同一张图片中
+        auto columns = tileset_json.value("columns", 0);
+        auto tile_size = sf::Vector2i(tileset_json.value("tilewidth", 0), tileset_json.value("tileheight", 0));
+        auto tile_count = tileset_json.value("tilecount", 0);
+        if (columns <= 0 || tile_count <= 0) {
+            spdlog::error("Tileset 文件 '{}' 缺少有效的 'columns' 或 'tilecount' 属性。", tileset_path);
+            return std::nullopt;
+        }
+        tileset.textures.push_back(resolve_path(tileset_json["image"].get<std::string>(), tileset_path));
+        tileset.tiles.resize(tile_count);
+        for (int local_id = 0; local_id < tile_count; ++local_id) {
+            auto& tile = tileset.tiles[local_id];
+            tile.valid = true;
+            tile.rect = {{(local_id % columns) * tile_size.x, (local_id / columns) * tile_size.y}, tile_size};
+            tile.type = engine::component::TileType::Normal;
+        }
+        for (const auto& tile_json : tiles_json) {      // 只有设置了属性的瓦片才会出现在 tiles 数组中
+            auto local_id = tile_json.value("id", -1);
+            if (local_id < 0 || local_id >= tile_count) continue;
+            parse_tile_properties(tile_json, tileset.tiles[local_id]);
+        }
+        return tileset;
+    }
+
+    // 多图片：每个瓦片是一张独立的图片，id 可能不连续
+    if (!tileset_json.contains("tiles")) {
+        spdlog::error("Tileset 文件 '{}' 缺少 'tiles' 属性。", tileset_path);
+        return std::nullopt;
+    }
+    int max_id = -1;
+    for (const auto& tile_json : tiles_json) max_id = std::max(max_id, tile_json.value("id", -1));
+    tileset.tiles.resize(max_id + 1);
+    for (const auto& tile_json : tiles_json) {
+        auto local_id = tile_json.value("id", -1);
+        if (local_id < 0) continue;
+        if (!tile_json.contains("image")) {
+            spdlog::error("Tileset 文件 '{}' 中瓦片 {} 缺少 'image' 属性。", tileset_path, local_id);
+            continue;
+        }
+        auto& tile = tileset.tiles[local_id];
+        tile.valid = true;
+        tile.texture = static_cast<uint32_t>(tileset.textures.size());
+        tileset.textures.push_back(resolve_path(tile_json["image"].get<std::string>(), tileset_path));
+        // tiled中源矩形信息只有设置了才会有值，未设置则使用图片尺寸
+        auto image_width = tile_json.value("imagewidth", 0);
+        auto image_height = tile_json.value("imageheight", 0);
+        tile.rect = {
+            {tile_json.value("x", 0), tile_json.value("y", 0)},
+            {tile_json.value("width", image_width), tile_json.value("height", image_height)}
+        };
+        parse_tile_properties(tile_json, tile);
+    }
+    return tileset;
+}
+
+std::string Tileset::resolve_path(std::string_view relative_path, std::string_view file_path) {
+    try {
+        // 获取文件的父目录 "assets/maps/level1.tmj" -> "assets/maps"
+        auto map_dir = std::filesystem::path(file_path).parent_path();
+        /* lexically_normal：纯字符串层面解析当前目录（.）和上级目录（..）导航符，得到一个干净的相对路径；
+           不访问文件系统，资源只存在于资源包中时同样适用，且与场景代码中直接书写的 "assets/..." 路径是同一个资源键 */
+        return (map_dir / relative_path).lexically_normal().generic_string();
+    } catch (const std::exception& e) {
+        spdlog::error("解析路径失败: {}", e.what());
+        return std::string(relative_path);
+    }
+}
+} // namespace engine::scene
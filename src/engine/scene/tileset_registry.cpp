@@ -0,0 +1,59 @@
+#include "tileset_registry.hpp"
+#include "content_hash.hpp"
+#include <spdlog/spdlog.h>
+#include <nlohmann/json.hpp>
+
+namespace engine::scene {
+
+std::shared_ptr<const Tileset> TilesetRegistry::get(std::string_view tileset_path, const FileReader& read_file) {
+    auto key = engine::resource::AssetArchive::normalize_path(tileset_path);
+    auto mtime = get_mtime(key);
+    {
+        std::lock_guard lock(mutex_);
+        if (auto it = entries_.find(key); it != entries_.end() && it->second.mtime == mtime) {
+            return it->second.tileset;
+        }
+    }
+
+    // 读取与解析在锁外进行；并发加载同一个图块集时后完成的结果覆盖先完成的，两者内容相同
+    auto tileset_file = read_file(key);
+    if (!tileset_file) {
+        spdlog::error("无法打开 Tileset 文件: {}", key);
+        return nullptr;
+    }
+    nlohmann::json ts_json;
+    try {
+        ts_json = nlohmann::json::parse(tileset_file->text());
+    } catch (const nlohmann::json::parse_error& e) {
+        spdlog::error("解析 Tileset json 文件 ‘{}’ 失败：{} (at byte {})", key, e.what(), e.byte);
+        return nullptr;
+    }
+    auto tileset = Tileset::parse(ts_json, key);
+    if (!tileset) return nullptr;
+    tileset->content_hash = engine::utils::hash_content(tileset_file->bytes());
+
+    auto shared = std::make_shared<const Tileset>(std::move(tileset.value()));
+    std::lock_guard lock(mutex_);
+    entries_.insert_or_assign(std::move(key), Entry{shared, mtime});
+    spdlog::info("Tileset 文件 ‘{}’ 加载完成，共 {} 个瓦片", shared->path, shared->tiles.size());
+    return shared;
+}
+
+void TilesetRegistry::clear() {
+    std::lock_guard lock(mutex_);
+    entries_.clear();
+}
+
+size_t TilesetRegistry::size() const {
+    std::lock_guard lock(mutex_);
+    return entries_.size();
+}
+
+std::optional<std::filesystem::file_time_type> TilesetRegistry::get_mtime(std::string_view path) {
+    std::error_code ec;
+    auto mtime = std::filesystem::last_write_time(path, ec);
+    if (ec) return std::nullopt;
+    return mtime;
+}
+
+} // namespace engine::scene
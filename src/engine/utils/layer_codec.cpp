@@ -0,0 +1,100 @@
+#include "layer_codec.hpp"
+#include <spdlog/spdlog.h>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <zlib.h>
+#ifdef ENGINE_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+namespace engine::utils {
+namespace {
+static_assert(std::endian::native == std::endian::little, "Tiled 图层数据为小端序，直接解压到 uint32 缓冲区");
+
+constexpr uint8_t INVALID = 0xFF;
+
+constexpr std::array<uint8_t, 256> make_base64_table() {
+    std::array<uint8_t, 256> table{};
+    table.fill(INVALID);
+    constexpr std::string_view ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (size_t i = 0; i < ALPHABET.size(); ++i) table[static_cast<uint8_t>(ALPHABET[i])] = static_cast<uint8_t>(i);
+    return table;
+}
+constexpr auto BASE64_TABLE = make_base64_table();
+} // namespace
+
+std::optional<LayerCompression> parse_layer_compression(std::string_view compression) {
+    if (compression.empty()) return LayerCompression::None;
+    if (compression == "zlib") return LayerCompression::Zlib;
+    if (compression == "gzip") return LayerCompression::Gzip;
+    if (compression == "zstd") return LayerCompression::Zstd;
+    return std::nullopt;
+}
+
+std::optional<std::vector<std::byte>> base64_decode(std::string_view text) {
+    while (!text.empty() && text.back() == '=') text.remove_suffix(1);
+    std::vector<std::byte> output;
+    output.reserve(text.size() * 3 / 4);
+
+    uint32_t buffer = 0;
+    int bits = 0;
+    for (char c : text) {
+        auto value = BASE64_TABLE[static_cast<uint8_t>(c)];
+        if (value == INVALID) return std::nullopt;
+        buffer = (buffer << 6) | value;
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            output.push_back(static_cast<std::byte>((buffer >> bits) & 0xFF));
+        }
+    }
+    return output;
+}
+
+bool zlib_decompress(std::span<const std::byte> input, std::span<std::byte> output) {
+    z_stream stream{};
+    if (inflateInit2(&stream, 15 + 32) != Z_OK) return false;     // +32：自动识别 zlib 与 gzip 头部
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<std::byte*>(input.data()));
+    stream.avail_in = static_cast<uInt>(input.size());
+    stream.next_out = reinterpret_cast<Bytef*>(output.data());
+    stream.avail_out = static_cast<uInt>(output.size());
+    auto result = inflate(&stream, Z_FINISH);
+    auto written = stream.total_out;
+    inflateEnd(&stream);
+    return result == Z_STREAM_END && written == output.size();
+}
+
+bool zstd_decompress(std::span<const std::byte> input, std::span<std::byte> output) {
+#ifdef ENGINE_HAS_ZSTD
+    auto written = ZSTD_decompress(output.data(), output.size(), input.data(), input.size());
+    return !ZSTD_isError(written) && written == output.size();
+#else
+    (void)input;
+    (void)output;
+    spdlog::error("未启用 zstd 支持，无法解压 zstd 压缩的图层数据");
+    return false;
+#endif
+}
+
+bool decode_layer_data(std::string_view text, LayerCompression compression, std::span<uint32_t> gids) {
+    auto bytes = base64_decode(text);
+    if (!bytes) {
+        spdlog::error("图层数据不是有效的 base64 文本");
+        return false;
+    }
+    auto output = std::as_writable_bytes(gids);
+    switch (compression) {
+        case LayerCompression::None:
+            if (bytes->size() != output.size()) return false;
+            std::memcpy(output.data(), bytes->data(), output.size());
+            return true;
+        case LayerCompression::Zlib:
+        case LayerCompression::Gzip:
+            return zlib_decompress(bytes.value(), output);
+        case LayerCompression::Zstd:
+            return zstd_decompress(bytes.value(), output);
+    }
+    return false;
+}
+} // namespace engine::utils
@@ -0,0 +1,133 @@
+#include "lz4.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace engine::utils {
+namespace {
+constexpr size_t MIN_MATCH = 4;             ///< @brief 最短匹配长度
+constexpr size_t LAST_LITERALS = 5;         ///< @brief 块末尾必须保留为字面量的字节数
+constexpr size_t MATCH_FIND_LIMIT = 12;     ///< @brief 最后一个匹配的起点距块末尾的最小距离
+constexpr size_t MAX_OFFSET = 65535;        ///< @brief 最大回溯距离
+constexpr unsigned HASH_BITS = 16;
+
+uint32_t read32(const uint8_t* ptr) {
+    uint32_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+uint32_t hash_sequence(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - HASH_BITS);
+}
+
+/// @brief 写入超过 15 的长度扩展字节（255 的重复 + 余数）
+void write_length(std::vector<std::byte>& out, size_t length) {
+    while (length >= 255) {
+        out.push_back(std::byte{255});
+        length -= 255;
+    }
+    out.push_back(static_cast<std::byte>(length));
+}
+
+/// @brief 读取长度扩展字节，越界返回 false
+bool read_length(std::span<const std::byte> input, size_t& pos, size_t& length) {
+    uint8_t value = 0;
+    do {
+        if (pos >= input.size()) return false;
+        value = static_cast<uint8_t>(input[pos++]);
+        length += value;
+    } while (value == 255);
+    return true;
+}
+
+void write_sequence(std::vector<std::byte>& out, const uint8_t* literals, size_t literal_length, size_t match_length, size_t offset) {
+    size_t match_code = match_length - MIN_MATCH;
+    auto token = static_cast<uint8_t>((std::min<size_t>(literal_length, 15) << 4) | std::min<size_t>(match_code, 15));
+    out.push_back(static_cast<std::byte>(token));
+    if (literal_length >= 15) write_length(out, literal_length - 15);
+
+    auto* begin = reinterpret_cast<const std::byte*>(literals);
+    out.insert(out.end(), begin, begin + literal_length);
+
+    out.push_back(static_cast<std::byte>(offset & 0xFF));
+    out.push_back(static_cast<std::byte>((offset >> 8) & 0xFF));
+    if (match_code >= 15) write_length(out, match_code - 15);
+}
+} // namespace
+
+std::vector<std::byte> lz4_compress(std::span<const std::byte> input) {
+    const auto* src = reinterpret_cast<const uint8_t*>(input.data());
+    const size_t size = input.size();
+
+    std::vector<std::byte> out;
+    out.reserve(size + size / 255 + 16);
+
+    size_t anchor = 0;
+    if (size >= MATCH_FIND_LIMIT) {
+        std::vector<int64_t> table(size_t{1} << HASH_BITS, -1);
+        const size_t match_limit = size - LAST_LITERALS;
+        size_t pos = 0;
+        while (pos + MATCH_FIND_LIMIT <= size) {
+            uint32_t sequence = read32(src + pos);
+            auto& entry = table[hash_sequence(sequence)];
+            int64_t candidate = entry;
+            entry = static_cast<int64_t>(pos);
+
+            if (candidate < 0 || pos - static_cast<size_t>(candidate) > MAX_OFFSET || read32(src + candidate) != sequence) {
+                ++pos;
+                continue;
+            }
+
+            size_t match_length = MIN_MATCH;
+            while (pos + match_length < match_limit && src[candidate + match_length] == src[pos + match_length]) {
+                ++match_length;
+            }
+            write_sequence(out, src + anchor, pos - anchor, match_length, pos - static_cast<size_t>(candidate));
+            pos += match_length;
+            anchor = pos;
+        }
+    }
+
+    // 最后一段只有字面量
+    size_t literal_length = size - anchor;
+    out.push_back(static_cast<std::byte>(std::min<size_t>(literal_length, 15) << 4));
+    if (literal_length >= 15) write_length(out, literal_length - 15);
+    out.insert(out.end(), input.begin() + static_cast<std::ptrdiff_t>(anchor), input.end());
+    return out;
+}
+
+bool lz4_decompress(std::span<const std::byte> input, std::span<std::byte> output) {
+    size_t ip = 0;
+    size_t op = 0;
+    while (ip < input.size()) {
+        auto token = static_cast<uint8_t>(input[ip++]);
+
+        size_t literal_length = token >> 4;
+        if (literal_length == 15 && !read_length(input, ip, literal_length)) return false;
+        if (literal_length > input.size() - ip || literal_length > output.size() - op) return false;
+        std::memcpy(output.data() + op, input.data() + ip, literal_length);
+        ip += literal_length;
+        op += literal_length;
+
+        if (ip == input.size()) break;      // 最后一段没有匹配部分
+
+        if (input.size() - ip < 2) return false;
+        size_t offset = static_cast<size_t>(input[ip]) | (static_cast<size_t>(input[ip + 1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > op) return false;
+
+        size_t match_length = token & 0x0F;
+        if (match_length == 15 && !read_length(input, ip, match_length)) return false;
+        match_length += MIN_MATCH;
+        if (match_length > output.size() - op) return false;
+
+        // 匹配可能与输出重叠（offset < match_length），必须逐字节复制
+        for (size_t i = 0; i < match_length; ++i) {
+            output[op + i] = output[op - offset + i];
+        }
+        op += match_length;
+    }
+    return op == output.size();
+}
+} // namespace engine::utils
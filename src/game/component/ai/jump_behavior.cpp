@@ -8,6 +8,13 @@
 #include <spdlog/spdlog.h>
 
 namespace game::component::ai {
+namespace {
+// update 每帧都会播放动画，名称预先驻留为 id
+const auto ANIMATION_IDLE = engine::render::AnimationId::intern("idle");
+const auto ANIMATION_JUMP = engine::render::AnimationId::intern("jump");
+const auto ANIMATION_FALL = engine::render::AnimationId::intern("fall");
+} // namespace
+
 JumpBehavior::JumpBehavior(AIComponent* ai_component
                          , float min_x
                          , float max_x
@@ -67,7 +74,7 @@ void JumpBehavior::update(sf::Time delta_time) {
             }
             auto jump_vel_x = jumping_right_ ? jump_vel_.x : -jump_vel_.x;  // 确定水平跳跃方向
             physics_component->velocity_= {jump_vel_x, jump_vel_.y};        // 设置速度
-            animation_component->play_animation("jump");                    // 播放跳跃动画
+            animation_component->play_animation(ANIMATION_JUMP);                    // 播放跳跃动画
 
             // 更新精灵翻转
             const auto& scale = transform_component->get_scale();
@@ -77,13 +84,13 @@ void JumpBehavior::update(sf::Time delta_time) {
                 transform_component->set_scale({std::abs(scale.x), scale.y});
             }
         } else {    // 还在地面等待
-             animation_component->play_animation("idle");
+             animation_component->play_animation(ANIMATION_IDLE);
         }
     } else {        // 在空中, 根据垂直速度判断是上升(jump)还是下落(fall)
         if (physics_component->get_velocity().y < 0.f) {
-            animation_component->play_animation("jump");
+            animation_component->play_animation(ANIMATION_JUMP);
         } else {
-            animation_component->play_animation("fall");
+            animation_component->play_animation(ANIMATION_FALL);
         }
     }
 }
@@ -7,6 +7,10 @@
 #include <spdlog/spdlog.h>
 
 namespace game::component::ai {
+namespace {
+const auto ANIMATION_WALK = engine::render::AnimationId::intern("walk");
+} // namespace
+
 PatrolBehavior::PatrolBehavior(AIComponent* ai_component, float min_x, float max_x, float speed)
     : AIBehavior{ai_component}
     , patrol_min_x_{min_x}
@@ -19,7 +23,7 @@ PatrolBehavior::PatrolBehavior(AIComponent* ai_component, float min_x, float max
 
     // 播放动画 (进行 patrol 行为的对象应该有 'walk' 动画)
     if (auto* animation_component = ai_component->get_animation_component(); animation_component) {
-        animation_component->play_animation("walk");
+        animation_component->play_animation(ANIMATION_WALK);
     }
 }
 
@@ -6,6 +6,10 @@
 #include <spdlog/spdlog.h>
 
 namespace game::component::ai {
+namespace {
+const auto ANIMATION_FLY = engine::render::AnimationId::intern("fly");
+} // namespace
+
 UpDownBehavior::UpDownBehavior(AIComponent* ai_component, float min_y, float max_y, float speed)
     : AIBehavior{ai_component}
     , patrol_min_y_{min_y}
@@ -18,7 +22,7 @@ UpDownBehavior::UpDownBehavior(AIComponent* ai_component, float min_y, float max
 
     // 播放动画 (进行 up-down 行为的对象应该有 'fly' 动画)
     if (auto* animation_component = ai_component_obs_->get_animation_component(); animation_component) {
-        animation_component->play_animation("fly");
+        animation_component->play_animation(ANIMATION_FLY);
     }
 
     // 禁用重力
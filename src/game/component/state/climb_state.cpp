@@ -15,7 +15,7 @@ namespace game::component::state {
 ClimbState::ClimbState(PlayerComponent* player_component)
     : PlayerState{player_component} {
     spdlog::debug("进入攀爬状态");
-    play_animation("climb");
+    play_animation(animation_ids::CLIMB);
     if (auto* physics = player_component_obs_->get_physics_component(); physics) {
         physics->set_use_gravity(false); // 禁用重力
     }
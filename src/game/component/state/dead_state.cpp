@@ -11,7 +11,7 @@ DeadState::DeadState(PlayerComponent* player_component)
     : PlayerState{player_component} {
     spdlog::debug("玩家进入死亡状态。");
     
-    play_animation("hurt");  // 播放死亡(受伤)动画
+    play_animation(animation_ids::HURT);  // 播放死亡(受伤)动画
 
     if (auto* audio_component = player_component_obs_->get_audio_component(); audio_component) {
         audio_component->play_sound("dead");  // 播放死亡音效
@@ -12,7 +12,7 @@ namespace game::component::state {
 FallState::FallState(PlayerComponent* player_component)
     : PlayerState{player_component} {
     // 播放动画
-    play_animation("fall");
+    play_animation(animation_ids::FALL);
         
     spdlog::debug("PlayerComponent 进入 FallState");
 }
@@ -11,7 +11,7 @@
 namespace game::component::state {
 HurtState::HurtState(PlayerComponent* player_component)
     : PlayerState{player_component} {
-    play_animation("hurt");  // 播放受伤动画
+    play_animation(animation_ids::HURT);  // 播放受伤动画
 
     if (auto* audio_component = player_component_obs_->get_audio_component(); audio_component) {
         audio_component->play_sound("hurt");  // 播放受伤音效
@@ -13,7 +13,7 @@ namespace game::component::state {
 IdleState::IdleState(PlayerComponent* player_component)
     : PlayerState{player_component} {
     // 播放动画
-    play_animation("idle");
+    play_animation(animation_ids::IDLE);
     
     spdlog::debug("PlayerComponent 进入 IdleState");
 }
@@ -12,7 +12,7 @@ namespace game::component::state {
 JumpState::JumpState(PlayerComponent* player_component)
     : PlayerState{player_component} {
     // 播放动画
-    play_animation("jump");
+    play_animation(animation_ids::JUMP);
         
     if (auto* audio_component = player_component_obs_->get_audio_component(); audio_component) {
         audio_component->play_sound("jump");  // 播放跳跃音效
@@ -12,19 +12,19 @@ PlayerState::PlayerState(PlayerComponent* player_component)
     }
 }
 
-void PlayerState::play_animation(std::string_view animation_name) {
+void PlayerState::play_animation(engine::render::AnimationId animation_id) {
     if (!player_component_obs_) {
-        spdlog::error("PlayerState 没有关联的 PlayerComponent，无法播放动画 '{}'", animation_name);
+        spdlog::error("PlayerState 没有关联的 PlayerComponent，无法播放动画 '{}'", animation_id.get_name());
         return;
     }
     
     auto animation_component = player_component_obs_->get_animation_component();
     if (!animation_component) {
         spdlog::error("PlayerComponent '{}' 没有 AnimationComponent，无法播放动画 '{}'", 
-                      player_component_obs_ ->get_owner()->get_name(), animation_name);
+                      player_component_obs_ ->get_owner()->get_name(), animation_id.get_name());
         return;
     }
 
-    animation_component->play_animation(animation_name);
+    animation_component->play_animation(animation_id);
 }
 } // namespace game::component::state
\ No newline at end of file
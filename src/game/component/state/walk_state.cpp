@@ -16,7 +16,7 @@ namespace game::component::state {
 WalkState::WalkState(PlayerComponent* player_component)
     : PlayerState{player_component} {
     // 播放动画
-    play_animation("walk");
+    play_animation(animation_ids::WALK);
     
     spdlog::debug("PlayerComponent 进入 WalkState");
 }
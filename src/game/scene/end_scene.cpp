@@ -20,14 +20,16 @@ EndScene::EndScene(engine::core::Context& context
     if (!session_data_) {
         spdlog::error("错误：结束场景收到了空的游戏数据！");
     }
+    spdlog::trace("EndScene (胜利：{}) 创建.", session_data_->get_is_win() ? "是" : "否");
+}
+
+void EndScene::init() {
     // 设置游戏状态为 GameOver
     context_.get_game_state().set_state(engine::core::State::GameOver);
 
     create_ui();
 
     spdlog::info("EndScene 初始化完成。");
-
-    spdlog::trace("EndScene (胜利：{}) 创建.", session_data_->get_is_win() ? "是" : "否");
 }
 
 void EndScene::create_ui() {
@@ -34,19 +34,66 @@
 #include <spdlog/spdlog.h>
 
 namespace game::scene {
+namespace {
+// 场景代码中直接引用的资源（关卡引用的资源由 LevelLoader 生成清单）
+constexpr std::string_view ENEMY_EFFECT_TEXTURE = "assets/textures/FX/enemy-deadth.png";
+constexpr std::string_view ITEM_EFFECT_TEXTURE = "assets/textures/FX/item-feedback.png";
+constexpr std::string_view FULL_HEART_TEXTURE = "assets/textures/UI/Heart.png";
+constexpr std::string_view EMPTY_HEART_TEXTURE = "assets/textures/UI/Heart-bg.png";
+constexpr std::string_view STOMP_SOUND = "assets/audio/punch2a.mp3";
+constexpr std::string_view PICKUP_SOUND = "assets/audio/poka01.mp3";
+constexpr std::string_view BACKGROUND_MUSIC = "assets/audio/hurry_up_and_run.ogg";
+constexpr std::string_view UI_FONT = "assets/fonts/VonwaonBitmap-16px.ttf";
+
+// 场景代码中播放的动画
+const auto ANIMATION_IDLE = engine::render::AnimationId::intern("idle");
+const auto ANIMATION_EFFECT = engine::render::AnimationId::intern("effect");
+} // namespace
+
 GameScene::GameScene(engine::core::Context& context
                    , engine::scene::SceneManager& scene_manager
-                   , std::shared_ptr<game::data::SessionData> data)
+                   , std::shared_ptr<game::data::SessionData> data
+                   , std::optional<sf::Vector2f> player_position)
     : Scene{"GameScene", context, scene_manager}
-    , game_session_data_{std::move(data)} {
-    context_.get_game_state().set_state(engine::core::State::Playing);
-    
+    , game_session_data_{std::move(data)}
+    , player_spawn_override_{player_position} {
     if (!game_session_data_) {      // 如果没有传入SessionData，则创建一个默认的
         game_session_data_ = std::make_shared<game::data::SessionData>();
         spdlog::info("未提供 SessionData，使用默认值。");
     }
+    spdlog::trace("GameScene 构造成功");
+}
+
+GameScene::~GameScene() = default;
+
+void GameScene::collect_resources(engine::resource::ResourceManifest& manifest) {
+    // 加载阶段：关卡引用的资源 + 场景代码中直接使用的资源，全部预加载后再创建游戏对象
+    engine::scene::LevelLoader level_loader(context_);
+    if (!level_loader.collect_manifest(game_session_data_->get_map_path(), manifest)) {
+        spdlog::error("关卡资源清单生成失败！");
+        return;
+    }
+    manifest.add_texture(ENEMY_EFFECT_TEXTURE);
+    manifest.add_texture(ITEM_EFFECT_TEXTURE);
+    manifest.add_texture(FULL_HEART_TEXTURE);
+    manifest.add_texture(EMPTY_HEART_TEXTURE);
+    manifest.add_sound(STOMP_SOUND);
+    manifest.add_sound(PICKUP_SOUND);
+    manifest.add_music(BACKGROUND_MUSIC);
+    manifest.add_font(UI_FONT);
+}
+
+void GameScene::init() {
+    context_.get_game_state().set_state(engine::core::State::Playing);
     game_session_data_->sync_high_score("assets/save.json");      // 更新最高分
 
+    // 解析运行时用到的资源句柄（资源本身已在加载阶段随关卡清单一起预加载）
+    auto& resource_manager = context_.get_resource_manager();
+    enemy_effect_texture_ = resource_manager.get_texture_handle(ENEMY_EFFECT_TEXTURE);
+    item_effect_texture_ = resource_manager.get_texture_handle(ITEM_EFFECT_TEXTURE);
+    stomp_sound_ = resource_manager.get_sound_handle(STOMP_SOUND);
+    pickup_sound_ = resource_manager.get_sound_handle(PICKUP_SOUND);
+
     if (!init_level()) {
         spdlog::error("关卡初始化失败！");
         return;
@@ -65,13 +112,11 @@ GameScene::GameScene(engine::core::Context& context
     }
 
     // 播放背景音乐 (默认循环)
-    context_.get_audio_player().play_music("assets/audio/hurry_up_and_run.ogg");
+    context_.get_audio_player().play_music(BACKGROUND_MUSIC);
 
-    spdlog::trace("GameScene 构造成功");
+    spdlog::trace("GameScene 初始化完成");
 }
 
-GameScene::~GameScene() = default;
-
 void GameScene::update(sf::Time delta) {
     Scene::update(delta);
     handle_object_collisions();
@@ -79,8 +124,8 @@ void GameScene::update(sf::Time delta) {
 
 
     // 玩家掉出地图下方则判断为失败
-    if (player_obs_ ) {
-        auto pos = player_obs_->get_component<engine::component::TransformComponent>()->get_position();
+    if (auto* player = get_player()) {
+        auto pos = player->get_component<engine::component::TransformComponent>()->get_position();
         auto world_rect = context_.get_physics_engine().get_world_bounds();
         // 多100像素冗余量
         if (world_rect && pos.y > world_rect->position.y + world_rect->size.y + 100.f) {
@@ -104,6 +149,22 @@ void GameScene::handle_input() {
     }
 }
 
+void GameScene::on_asset_changed(std::string_view path) {
+    Scene::on_asset_changed(path);
+    if (!path.ends_with(".tmj") && !path.ends_with(".tsj")) return;
+    if (path.ends_with(".tmj") && path != game_session_data_->get_map_path()) return;      // 其它关卡的地图
+    if (scene_manager_.get_current_scene() != this) return;    // 被菜单覆盖时不重载（替换场景会清空整个场景栈）
+
+    std::optional<sf::Vector2f> player_position;
+    if (auto* player = get_player()) {
+        if (auto* transform = player->get_component<engine::component::TransformComponent>()) {
+            player_position = transform->get_position();
+        }
+    }
+    spdlog::info("关卡文件 '{}' 已变化，重新加载当前关卡", path);
+    scene_manager_.request_replace_scene(std::make_unique<GameScene>(context_, scene_manager_, game_session_data_, player_position));
+}
+
 bool GameScene::init_level() {
     // 加载关卡
     engine::scene::LevelLoader level_loader(context_);
@@ -130,36 +191,40 @@ bool GameScene::init_level() {
     spdlog::info("注册'main'层到物理引擎");
 
     // 设置相机边界和世界边界
-    auto world_size = tile_layer->get_world_size();
-    context_.get_camera().set_limit_bounds(sf::FloatRect(sf::Vector2f(0.f, 0.f), world_size));
-    context_.get_camera().set_world_view_center(context_.get_camera().get_world_view_size() / 2.f);     // 涉及到切换场景，将位置重置为初始位置
-    context_.get_physics_engine().set_world_bounds(sf::FloatRect(sf::Vector2f(0.f, 0.f), world_size));
+    auto world_bounds = tile_layer->get_world_bounds();     // 无限地图的原点可能为负
+    context_.get_camera().set_limit_bounds(world_bounds);
+    context_.get_camera().set_world_view_center(world_bounds.position + context_.get_camera().get_world_view_size() / 2.f);     // 涉及到切换场景，将位置重置为初始位置
+    context_.get_physics_engine().set_world_bounds(world_bounds);
 
     return true;
 }
 
 bool GameScene::init_player() {
-    // 获取玩家对象指针
-    player_obs_ = find_game_object_by_name("player");
-    if (!player_obs_) {
+    // 获取玩家对象并保存句柄
+    auto* player = find_game_object_by_name("player");
+    if (!player) {
         spdlog::error("未找到玩家对象");
         return false;
     }
+    player_handle_ = player->get_handle();
 
     // 添加PlayerComponent到玩家对象
-    auto* player_component = player_obs_->add_component<game::component::PlayerComponent>();
+    auto* player_component = player->add_component<game::component::PlayerComponent>();
     if (!player_component) {
         spdlog::error("无法添加PlayerComponent到玩家对象");
         return false;
     }
 
     // 继承上一关的生命值
-    auto health_component = player_obs_->get_component<engine::component::HealthComponent>();
+    auto health_component = player->get_component<engine::component::HealthComponent>();
     health_component->set_current_health(game_session_data_->get_current_health());
     health_component->set_max_health(game_session_data_->get_max_health());
 
     // 相机跟随玩家
-    auto* player_transform = player_obs_->get_component<engine::component::TransformComponent>();
+    auto* player_transform = player->get_component<engine::component::TransformComponent>();
+    if (player_transform && player_spawn_override_) {
+        player_transform->set_position(player_spawn_override_.value());
+    }
     if (player_transform) {
         context_.get_camera().set_target(player_transform);
     } else {
@@ -171,37 +236,36 @@ bool GameScene::init_player() {
 
 bool GameScene::init_enemy_and_item() {
     bool success = true;
-    for (auto& game_object : game_objects_){
-        if (game_object->get_name() == "eagle"){
-            if (auto* ai_component = game_object->add_component<game::component::AIComponent>(); ai_component){
-                auto y_max = game_object->get_component<engine::component::TransformComponent>()->get_position().y;
-                auto y_min = y_max - 80.f;    // 让鹰的飞行范围 (当前位置与上方80像素 的区域)
-                ai_component->set_behavior(std::make_unique<game::component::ai::UpDownBehavior>(ai_component, y_min, y_max));
-            }
+    // 通过场景的名称/标签索引只访问对应的对象，不再遍历整个场景
+    for_each_with_name("eagle", [](engine::object::GameObject& game_object) {
+        if (auto* ai_component = game_object.add_component<game::component::AIComponent>(); ai_component){
+            auto y_max = game_object.get_component<engine::component::TransformComponent>()->get_position().y;
+            auto y_min = y_max - 80.f;    // 让鹰的飞行范围 (当前位置与上方80像素 的区域)
+            ai_component->set_behavior(std::make_unique<game::component::ai::UpDownBehavior>(ai_component, y_min, y_max));
         }
-        if (game_object->get_name() == "frog"){
-            if (auto* ai_component = game_object->add_component<game::component::AIComponent>(); ai_component){
-                auto x_max = game_object->get_component<engine::component::TransformComponent>()->get_position().x - 10.f;
-                auto x_min = x_max - 90.f;    // 青蛙跳跃范围（右侧 - 10.f 是为了增加稳定性）
-                ai_component->set_behavior(std::make_unique<game::component::ai::JumpBehavior>(ai_component, x_min, x_max));
-            }
+    });
+    for_each_with_name("frog", [](engine::object::GameObject& game_object) {
+        if (auto* ai_component = game_object.add_component<game::component::AIComponent>(); ai_component){
+            auto x_max = game_object.get_component<engine::component::TransformComponent>()->get_position().x - 10.f;
+            auto x_min = x_max - 90.f;    // 青蛙跳跃范围（右侧 - 10.f 是为了增加稳定性）
+            ai_component->set_behavior(std::make_unique<game::component::ai::JumpBehavior>(ai_component, x_min, x_max));
         }
-        if (game_object->get_name() == "opossum"){
-            if (auto* ai_component = game_object->add_component<game::component::AIComponent>(); ai_component){
-                auto x_max = game_object->get_component<engine::component::TransformComponent>()->get_position().x;
-                auto x_min = x_max - 200.f;   // 负鼠巡逻范围
-                ai_component->set_behavior(std::make_unique<game::component::ai::PatrolBehavior>(ai_component, x_min, x_max));
-            }
+    });
+    for_each_with_name("opossum", [](engine::object::GameObject& game_object) {
+        if (auto* ai_component = game_object.add_component<game::component::AIComponent>(); ai_component){
+            auto x_max = game_object.get_component<engine::component::TransformComponent>()->get_position().x;
+            auto x_min = x_max - 200.f;   // 负鼠巡逻范围
+            ai_component->set_behavior(std::make_unique<game::component::ai::PatrolBehavior>(ai_component, x_min, x_max));
         }
-        if (game_object->get_tag() == "item"){
-            if (auto* ac = game_object->get_component<engine::component::AnimationComponent>(); ac){
-                ac->play_animation("idle");
-            } else {
-                spdlog::error("Item对象缺少 AnimationComponent，无法播放动画。");
-                success = false;
-            }
+    });
+    for_each_with_tag("item", [&success](engine::object::GameObject& game_object) {
+        if (auto* ac = game_object.get_component<engine::component::AnimationComponent>(); ac){
+            ac->play_animation(ANIMATION_IDLE);
+        } else {
+            spdlog::error("Item对象缺少 AnimationComponent，无法播放动画。");
+            success = false;
         }
-    }
+    });
 
     return success;
 }
@@ -263,12 +327,14 @@ void GameScene::handle_tile_triggers() {
 }
 
 void GameScene::handle_player_damage(int damage) {
-    auto player_component = player_obs_->get_component<game::component::PlayerComponent>();
+    auto* player = get_player();
+    if (!player) return;
+    auto player_component = player->get_component<game::component::PlayerComponent>();
     if (!player_component->take_damage(damage)) { // 没有受伤，直接返回
         return;
     }
     if (player_component->is_dead()) {
-        spdlog::info("玩家 {} 死亡", player_obs_->get_name());
+        spdlog::info("玩家 {} 死亡", player->get_name());
         // TODO: 可能的死亡逻辑处理
     }
 
@@ -299,8 +365,8 @@ void GameScene::player_vs_enemy_collision(engine::object::GameObject* player, en
             // 玩家跳起效果
             player->get_component<engine::component::PhysicsComponent>()->velocity_.y = -300.f;  // 向上跳起
 
-            // 播放音效 (此音效完全可以放在玩家的音频组件中，这里示例另一种用法：直接用AudioPlayer播放，传入文件路径)
-            context_.get_audio_player().play_sound("assets/audio/punch2a.mp3");
+            // 播放音效 (此音效完全可以放在玩家的音频组件中，这里示例另一种用法：直接用AudioPlayer播放，传入预先解析的句柄)
+            context_.get_audio_player().play_sound(stomp_sound_);
             add_score_with_ui(10);
         } else {
             spdlog::info("敌人 {} 对玩家 {} 造成伤害", enemy->get_name(), player->get_name());
@@ -318,7 +384,7 @@ void GameScene::player_vs_item_collision(engine::object::GameObject*, engine::ob
     item->set_need_remove(true);  // 标记道具为待删除状态
     auto item_aabb = item->get_component<engine::component::ColliderComponent>()->get_world_aabb();
     create_effect(item_aabb.position + item_aabb.size / 2.f, item->get_tag());  // 创建特效
-    context_.get_audio_player().play_sound("assets/audio/poka01.mp3");          // 播放音效
+    context_.get_audio_player().play_sound(pickup_sound_);                      // 播放音效
 }
 
 void GameScene::to_next_level(engine::object::GameObject* trigger) {
@@ -338,37 +404,43 @@ void GameScene::show_end_scene(bool is_win) {
 
 void GameScene::create_effect(sf::Vector2f center_pos, std::string_view tag) {
     // --- 创建游戏对象和变换组件 ---
-    auto effect_obj = std::make_unique<engine::object::GameObject>("effect_" + std::string(tag));
+    auto effect_obj = create_game_object("effect_" + std::string(tag));
     auto transform = effect_obj->add_component<engine::component::TransformComponent>(center_pos);
 
-    // --- 根据标签创建不同的精灵组件和动画---
-    auto animation = std::make_unique<engine::render::Animation>("effect", false);
+    // --- 根据标签创建不同的精灵组件和动画（动画片段只在首次使用时构建，之后从动画库共享）---
+    auto& animation_library = context_.get_resource_manager().get_animation_library();
+    auto effect_key = "effect/" + std::string(tag);
+    const auto* animation = animation_library.find(effect_key, "effect");
+    auto build_animation = [&](sf::Vector2i frame_size, int frame_count) {
+        if (animation) return;
+        auto clip = std::make_unique<engine::render::Animation>("effect", false);
+        for (auto i = 0; i < frame_count; i++) {
+            clip->add_frame({{(i * frame_size.x), 0}, frame_size}, sf::seconds(0.1f));
+        }
+        animation = animation_library.add(effect_key, std::move(clip));
+    };
     if (tag == "enemy") {
         effect_obj->add_component<engine::component::SpriteComponent>(
-            *context_.get_resource_manager().get_texture("assets/textures/FX/enemy-deadth.png")
+            *context_.get_resource_manager().get_texture(enemy_effect_texture_)
         );
         transform->set_origin({20.f, 20.5f});
-        for (auto i = 0; i < 5; i++) {
-            animation->add_frame({{(i * 40), 0}, {40, 41}}, sf::seconds(0.1f));
-        }
+        build_animation({40, 41}, 5);
     } else if (tag == "item") {
         effect_obj->add_component<engine::component::SpriteComponent>(
-            *context_.get_resource_manager().get_texture("assets/textures/FX/item-feedback.png")
+            *context_.get_resource_manager().get_texture(item_effect_texture_)
         );
         transform->set_origin({16.f, 16.f});
-        for (auto i = 0; i < 4; i++) {
-            animation->add_frame({{(i * 32), 0}, {32, 32}}, sf::seconds(0.1f));
-        }
+        build_animation({32, 32}, 4);
     } else {
         spdlog::warn("未知特效类型: {}", tag);
         return;
     }
 
     // --- 根据创建的动画，添加动画组件，并设置为单次播放 ---
-    auto* animation_component = effect_obj->add_component<engine::component::AnimationComponent>();
-    animation_component->add_animation(std::move(animation));
+    auto* animation_component = effect_obj->add_component<engine::component::AnimationComponent>(&get_animation_system());
+    animation_component->add_animation(animation);
     animation_component->set_one_shot_removal(true);
-    animation_component->play_animation("effect");
+    animation_component->play_animation(ANIMATION_EFFECT);
     safe_add_game_object(std::move(effect_obj));  // 安全添加特效对象
     spdlog::debug("创建特效: {}", tag);
 }
@@ -378,7 +450,7 @@ void GameScene::create_score_ui() {
     auto score_text = "Score: " + std::to_string(game_session_data_->get_current_score());
     auto score_label = std::make_unique<engine::ui::UILabel>(context_.get_renderer(), 
                                                          score_text, 
-                                                         "assets/fonts/VonwaonBitmap-16px.ttf", 
+                                                         UI_FONT, 
                                                          16);
     score_label_obs_ = score_label.get();           // 成员变量赋值（获取裸指针）
     auto screen_size = ui_manager_->get_root_element()->get_size();        // 获取屏幕尺寸
@@ -394,8 +466,8 @@ void GameScene::create_health_ui() {
     float icon_width = 20.f;
     float icon_height = 18.f;
     float spacing = 5.f;
-    auto full_heart_tex = context_.get_resource_manager().get_texture("assets/textures/UI/Heart.png");
-    auto empty_heart_tex = context_.get_resource_manager().get_texture("assets/textures/UI/Heart-bg.png");
+    auto full_heart_tex = context_.get_resource_manager().get_texture(FULL_HEART_TEXTURE);
+    auto empty_heart_tex = context_.get_resource_manager().get_texture(EMPTY_HEART_TEXTURE);
 
     // 创建一个默认的UIPanel (不需要背景色，因此大小无所谓，只用于定位)
     auto health_panel = std::make_unique<engine::ui::UIPanel>();
@@ -424,12 +496,13 @@ void GameScene::create_health_ui() {
 }
 
 void GameScene::update_health_with_ui() {
-    if (!player_obs_ || !game_session_data_) {
+    auto* player = get_player();
+    if (!player || !game_session_data_) {
         spdlog::error("UI组件或数据不存在，无法更新生命值");
         return;
     }
 
-    auto health_component = player_obs_->get_component<engine::component::HealthComponent>();
+    auto health_component = player->get_component<engine::component::HealthComponent>();
     if (!health_component) {
         spdlog::error("玩家生命值组件不存在");
         return;
@@ -477,7 +550,9 @@ void GameScene::add_score_with_ui(int score) {
 }
 
 void GameScene::heal_with_ui(int amount) {
-    player_obs_->get_component<engine::component::HealthComponent>()->heal(amount);
+    auto* player = get_player();
+    if (!player) return;
+    player->get_component<engine::component::HealthComponent>()->heal(amount);
     update_health_with_ui();                              // 更新生命值与UI
 }
 } // namespace game::scene
\ No newline at end of file
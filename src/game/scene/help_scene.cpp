@@ -11,11 +11,15 @@
 namespace game::scene {
 HelpsScene::HelpsScene(engine::core::Context& context, engine::scene::SceneManager& scene_manager)
     : engine::scene::Scene{"HelpsScene", context, scene_manager} {
+    spdlog::trace("HelpsScene 创建.");
+}
+
+void HelpsScene::init() {
     auto window_size = context_.get_game_state().get_logical_size();
 
     // 创建帮助图片 UIImage （让它覆盖整个屏幕）
     auto help_image = std::make_unique<engine::ui::UIImage>(
-        *context.get_resource_manager().get_texture("assets/textures/UI/instructions.png"),
+        *context_.get_resource_manager().get_texture("assets/textures/UI/instructions.png"),
         sf::Vector2f(0.f, 0.f),
         window_size
     );
@@ -23,8 +27,6 @@ HelpsScene::HelpsScene(engine::core::Context& context, engine::scene::SceneManag
     ui_manager_->add_element(std::move(help_image));
 
     spdlog::trace("HelpsScene 初始化完成.");
-
-    spdlog::trace("HelpsScene 创建.");
 }
 
 void HelpsScene::handle_input() {
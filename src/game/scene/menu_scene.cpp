@@ -18,15 +18,17 @@ MenuScene::MenuScene(engine::core::Context& context
                    , std::shared_ptr<game::data::SessionData> session_data)
     : Scene{"MenuScene", context, scene_manager}
     , session_data_{std::move(session_data)} {
-    context_.get_game_state().set_state(engine::core::State::Paused);
     if (!session_data_) {
         spdlog::error("菜单场景构造时 SessionData 为空。");
     }
+    spdlog::trace("MenuScene 构造完成.");
+}
+
+void MenuScene::init() {
+    context_.get_game_state().set_state(engine::core::State::Paused);
     create_ui();
 
     spdlog::trace("menuScene 初始化完成");
-
-    spdlog::trace("MenuScene 构造完成.");
 }
 
 void MenuScene::create_ui() {
@@ -23,18 +23,35 @@ TitleScene::TitleScene(engine::core::Context& context
                      , std::shared_ptr<game::data::SessionData> session_data)
     : engine::scene::Scene{"TitleScene", context, scene_manager}
     , session_data_{std::move(session_data)} {
-    context_.get_game_state().set_state(engine::core::State::Title);
-    context_.get_camera().set_world_view_center(context_.get_camera().get_world_view_size() / 2.f);     // 涉及到切换场景，将位置重置为初始位置
-    context_.get_camera().set_limit_bounds(std::nullopt);       // 解除边界限制，让相机能正常移动
-
     if (!session_data_) {
         spdlog::warn("TitleScene 接收到空的 SessionData，创建一个默认的 SessionData");
         session_data_ = std::make_shared<game::data::SessionData>();
     }
+    spdlog::trace("TitleScene 创建");
+}
+
+void TitleScene::collect_resources(engine::resource::ResourceManifest& manifest) {
+    // 加载阶段：背景地图与 UI 用到的资源一次性预加载
+    engine::scene::LevelLoader level_loader(context_);
+    if (!level_loader.collect_manifest("assets/maps/level_0.tmj", manifest)) return;
+    manifest.add_texture("assets/textures/UI/title-screen.png");
+    for (std::string_view button : {"Start", "Load", "Helps", "Quit"}) {
+        for (int state = 1; state <= 3; ++state) {      // 按钮的 正常/悬停/按下 三种状态
+            manifest.add_texture("assets/textures/UI/buttons/" + std::string(button) + std::to_string(state) + ".png");
+        }
+    }
+    manifest.add_music("assets/audio/platformer_level03_loop.ogg");
+    manifest.add_font("assets/fonts/VonwaonBitmap-16px.ttf");
+}
+
+void TitleScene::init() {
+    context_.get_game_state().set_state(engine::core::State::Title);
+    context_.get_camera().set_world_view_center(context_.get_camera().get_world_view_size() / 2.f);     // 涉及到切换场景，将位置重置为初始位置
+    context_.get_camera().set_limit_bounds(std::nullopt);       // 解除边界限制，让相机能正常移动
     session_data_->sync_high_score("assets/save.json");      // 更新最高分
 
     // 加载背景地图
-    engine::scene::LevelLoader level_loader(context);
+    engine::scene::LevelLoader level_loader(context_);
     if (!level_loader.load_level("assets/maps/level_0.tmj", *this)) {
         spdlog::error("加载背景失败");
         return;
@@ -44,8 +61,6 @@ TitleScene::TitleScene(engine::core::Context& context
     create_ui();
 
     spdlog::trace("TitleScene 初始化完成.");
-
-    spdlog::trace("TitleScene 创建");
 }
 
 // 创建 UI 界面元素
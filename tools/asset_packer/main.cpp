@@ -0,0 +1,135 @@
+/**
+ * @brief 资源打包工具：把资源目录打包为 AssetArchive 可直接映射的单个文件
+ *
+ * 用法（在项目根目录运行，使包内路径与游戏加载时使用的 "assets/..." 一致）：
+ *     asset_packer [资源目录=assets] [输出文件=assets.pak]
+ *
+ * 文本类资源（地图、图块集、字体等）使用 LZ4 压缩；PNG、OGG 等本身已压缩的格式压缩收益很小，
+ * 压缩后体积没有明显减少的条目原样存储，运行时可以零拷贝读取。
+ * 配置与存档文件会被游戏写回，因此不打包。
+ */
+#include "asset_archive.hpp"
+#include "lz4.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+namespace fs = std::filesystem;
+using engine::resource::archive_format::Compression;
+
+constexpr double MIN_COMPRESSION_GAIN = 0.9;        ///< @brief 压缩后不大于原始大小的 90% 才采用压缩
+
+struct PackedEntry {
+    std::string path;
+    Compression compression = Compression::None;
+    std::vector<std::byte> data;                    ///< @brief 实际写入的数据（原始或压缩后）
+    uint64_t original_size = 0;
+    uint64_t offset = 0;
+};
+
+bool is_excluded(const fs::path& path) {
+    auto name = path.filename().string();
+    return name == "config.json" || name == "save.json";
+}
+
+bool read_file(const fs::path& path, std::vector<std::byte>& buffer) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) return false;
+    buffer.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size())));
+}
+
+template<typename T>
+void write_value(std::ofstream& out, T value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));     // 目标平台均为小端序
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    fs::path asset_dir = argc > 1 ? argv[1] : "assets";
+    fs::path output_path = argc > 2 ? argv[2] : "assets.pak";
+    if (!fs::is_directory(asset_dir)) {
+        spdlog::error("资源目录 '{}' 不存在", asset_dir.string());
+        return 1;
+    }
+
+    // 1. 收集文件（排序保证输出稳定）
+    std::vector<fs::path> files;
+    for (const auto& entry : fs::recursive_directory_iterator(asset_dir)) {
+        if (entry.is_regular_file() && !is_excluded(entry.path())) files.push_back(entry.path());
+    }
+    std::ranges::sort(files);
+
+    // 2. 读取并按需压缩
+    std::vector<PackedEntry> entries;
+    entries.reserve(files.size());
+    uint64_t total_original = 0;
+    uint64_t total_stored = 0;
+    for (const auto& file : files) {
+        PackedEntry entry;
+        entry.path = engine::resource::AssetArchive::normalize_path(file.generic_string());
+        if (entry.path.size() > UINT16_MAX) {
+            spdlog::error("路径过长，已跳过: {}", entry.path);
+            continue;
+        }
+        if (!read_file(file, entry.data)) {
+            spdlog::error("读取文件失败: {}", file.string());
+            return 1;
+        }
+        entry.original_size = entry.data.size();
+
+        auto compressed = engine::utils::lz4_compress(entry.data);
+        if (static_cast<double>(compressed.size()) <= static_cast<double>(entry.data.size()) * MIN_COMPRESSION_GAIN) {
+            entry.compression = Compression::LZ4;
+            entry.data = std::move(compressed);
+        }
+        total_original += entry.original_size;
+        total_stored += entry.data.size();
+        spdlog::debug("{} {} -> {} 字节", entry.path, entry.original_size, entry.data.size());
+        entries.push_back(std::move(entry));
+    }
+
+    // 3. 计算数据块偏移（紧跟在索引之后）
+    uint64_t offset = engine::resource::archive_format::HEADER_SIZE;
+    for (const auto& entry : entries) {
+        offset += engine::resource::archive_format::ENTRY_FIXED_SIZE + entry.path.size();
+    }
+    for (auto& entry : entries) {
+        entry.offset = offset;
+        offset += entry.data.size();
+    }
+
+    // 4. 写出
+    std::ofstream out(output_path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        spdlog::error("无法写入 '{}'", output_path.string());
+        return 1;
+    }
+    const auto& magic = engine::resource::archive_format::MAGIC;
+    out.write(magic.data(), magic.size());
+    write_value<uint32_t>(out, engine::resource::archive_format::VERSION);
+    write_value<uint32_t>(out, static_cast<uint32_t>(entries.size()));
+    for (const auto& entry : entries) {
+        write_value<uint16_t>(out, static_cast<uint16_t>(entry.path.size()));
+        out.write(entry.path.data(), static_cast<std::streamsize>(entry.path.size()));
+        write_value<uint8_t>(out, static_cast<uint8_t>(entry.compression));
+        write_value<uint64_t>(out, entry.offset);
+        write_value<uint64_t>(out, entry.data.size());
+        write_value<uint64_t>(out, entry.original_size);
+    }
+    for (const auto& entry : entries) {
+        out.write(reinterpret_cast<const char*>(entry.data.data()), static_cast<std::streamsize>(entry.data.size()));
+    }
+    if (!out) {
+        spdlog::error("写入 '{}' 失败", output_path.string());
+        return 1;
+    }
+
+    spdlog::info("已打包 {} 个文件到 '{}'：{} -> {} 字节", entries.size(), output_path.string(), total_original, total_stored);
+    return 0;
+}
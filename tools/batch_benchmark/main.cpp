@@ -0,0 +1,99 @@
+/**
+ * @brief 精灵批次基准：测量批次顶点生成耗时随线程数的变化
+ *
+ * 用法（在项目根目录运行）：
+ *     batch_benchmark [--max-threads N] [每批精灵数（千） ...]
+ * 不指定时测试 2、8、32 千个精灵。每种规模生成随机的精灵命令（位置、旋转、缩放、翻转），
+ * 分别以 1 至 N（默认为硬件并发数）个参与线程调用 build_sprite_vertices()（即 Renderer 刷新批次时的顶点生成），
+ * 输出多次调用的平均耗时及相对单线程的加速比。只测顶点生成，不涉及窗口与绘制提交。
+ */
+#include "sprite_batch.hpp"
+#include "thread_pool.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+constexpr int ITERATIONS = 200;             ///< @brief 每种配置的生成次数
+
+std::vector<engine::render::SpriteCommand> make_commands(size_t count) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position(0.f, 4096.f);
+    std::uniform_real_distribution<float> angle(0.f, 360.f);
+    std::uniform_real_distribution<float> scale(0.5f, 2.f);
+    std::uniform_int_distribution<int> tile(0, 15);
+    std::bernoulli_distribution flip(0.5);
+
+    std::vector<engine::render::SpriteCommand> commands(count);
+    for (auto& command : commands) {
+        command.transform.translate({position(rng), position(rng)});
+        command.transform.rotate(sf::degrees(angle(rng)));
+        command.transform.scale({scale(rng), scale(rng)});
+        int width = flip(rng) ? -16 : 16;
+        command.texture_rect = sf::IntRect({tile(rng) * 16, tile(rng) * 16}, {width, 16});
+        command.color = sf::Color::White;
+    }
+    return commands;
+}
+
+double average_ms(const std::vector<engine::render::SpriteCommand>& commands, std::vector<sf::Vertex>& vertices, engine::core::ThreadPool* pool) {
+    engine::render::build_sprite_vertices(commands, vertices, pool);    // 预热（分配顶点缓冲容量）
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) engine::render::build_sprite_vertices(commands, vertices, pool);
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / ITERATIONS;
+}
+
+
+bool parse_positive(std::string_view text, size_t& value) {
+    return std::from_chars(text.data(), text.data() + text.size(), value).ec == std::errc{} && value > 0;
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t hardware_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    size_t max_threads = hardware_threads;
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        size_t value = 0;
+        if (arg == "--max-threads" && i + 1 < argc) {
+            if (!parse_positive(argv[++i], max_threads)) {
+                spdlog::error("无效的线程数 '{}'", argv[i]);
+                return 1;
+            }
+            continue;
+        }
+        if (!parse_positive(arg, value)) {
+            spdlog::error("无效的精灵数量 '{}'", arg);
+            return 1;
+        }
+        sizes.push_back(value * 1000);
+    }
+    if (sizes.empty()) sizes = {2000, 8000, 32000};
+
+    spdlog::set_level(spdlog::level::warn);
+    std::printf("硬件并发数 %zu，测试 1-%zu 线程，每种配置 %d 次\n", hardware_threads, max_threads, ITERATIONS);
+
+    for (auto count : sizes) {
+        auto commands = make_commands(count);
+        std::vector<sf::Vertex> vertices;
+        std::printf("=== %zu 个精灵 ===\n", count);
+        double serial_ms = 0.0;
+        for (size_t threads = 1; threads <= max_threads; ++threads) {
+            // parallel_for 的调用线程也参与执行，因此 N 个参与线程对应 N - 1 个工作线程
+            auto pool = threads > 1 ? std::make_unique<engine::core::ThreadPool>(threads - 1) : nullptr;
+            auto ms = average_ms(commands, vertices, pool.get());
+            if (threads == 1) serial_ms = ms;
+            std::printf("%2zu 线程  %8.3f ms  加速比 %.2fx\n", threads, ms, serial_ms / ms);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,364 @@
+/**
+ * @brief 关卡加载基准：比较 Tiled 图层数据各种编码方式的文件大小与解析耗时
+ *
+ * 用法（在项目根目录运行）：
+ *     level_benchmark [地图文件.tmj ...]
+ *     level_benchmark --load [--scale N] [地图文件.tmj ...]
+ *
+ * 默认模式：不指定地图时测试 assets/maps 下的全部 .tmj。对每张地图，在内存中把所有瓦片层重新编码为
+ * csv（JSON 整数数组）、base64、base64+zlib、base64+gzip、base64+zstd（启用时），
+ * 再加上编译后的二进制关卡（.slvl），分别统计大小和多次解析的平均耗时。
+ * 图块集在第一次解析后被缓存，因此耗时只反映地图本身。
+ *
+ * --load 模式：用不打开窗口的引擎子系统构造 Context，通过 LevelLoader::load_level() 把关卡加载到场景，
+ * 分别以串行和线程池并行的准备阶段各加载多次，比较准备阶段与插入阶段的平均耗时。
+ * 不指定地图时测试 level_1，以及把 level_1 在两个方向各平铺 N 次（默认 8）生成的大型合成地图
+ * （临时写入 assets/maps，结束后删除）。
+ */
+#include "level_parser.hpp"
+#include "level_format.hpp"
+#include "layer_codec.hpp"
+#include "level_loader.hpp"
+#include "scene.hpp"
+#include "scene_manager.hpp"
+#include "context.hpp"
+#include "config.hpp"
+#include "thread_pool.hpp"
+#include "resource_manager.hpp"
+#include "input_manager.hpp"
+#include "render.hpp"
+#include "camera.hpp"
+#include "physics_engine.hpp"
+#include "audio_player.hpp"
+#include "game_state.hpp"
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <spdlog/spdlog.h>
+#include <zlib.h>
+#ifdef ENGINE_HAS_ZSTD
+#include <zstd.h>
+#endif
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+namespace fs = std::filesystem;
+using engine::resource::AssetData;
+
+constexpr int ITERATIONS = 50;              ///< @brief 每种编码的解析次数
+constexpr int LOAD_ITERATIONS = 10;         ///< @brief --load 模式下每种准备方式的加载次数
+constexpr std::string_view LOAD_DEFAULT_MAP = "assets/maps/level_1.tmj";
+constexpr std::string_view SYNTHETIC_MAP = "assets/maps/synthetic_benchmark.tmj";
+
+std::string base64_encode(std::span<const std::byte> bytes) {
+    constexpr std::string_view ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string text;
+    text.reserve((bytes.size() + 2) / 3 * 4);
+    for (size_t i = 0; i < bytes.size(); i += 3) {
+        uint32_t chunk = static_cast<uint32_t>(bytes[i]) << 16;
+        if (i + 1 < bytes.size()) chunk |= static_cast<uint32_t>(bytes[i + 1]) << 8;
+        if (i + 2 < bytes.size()) chunk |= static_cast<uint32_t>(bytes[i + 2]);
+        text += ALPHABET[(chunk >> 18) & 63];
+        text += ALPHABET[(chunk >> 12) & 63];
+        text += i + 1 < bytes.size() ? ALPHABET[(chunk >> 6) & 63] : '=';
+        text += i + 2 < bytes.size() ? ALPHABET[chunk & 63] : '=';
+    }
+    return text;
+}
+
+/// @brief zlib 或 gzip 压缩（window_bits 15 为 zlib 头部，31 为 gzip 头部）
+std::vector<std::byte> deflate_bytes(std::span<const std::byte> input, int window_bits) {
+    z_stream stream{};
+    deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY);
+    std::vector<std::byte> output(deflateBound(&stream, static_cast<uLong>(input.size())));
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<std::byte*>(input.data()));
+    stream.avail_in = static_cast<uInt>(input.size());
+    stream.next_out = reinterpret_cast<Bytef*>(output.data());
+    stream.avail_out = static_cast<uInt>(output.size());
+    deflate(&stream, Z_FINISH);
+    output.resize(stream.total_out);
+    deflateEnd(&stream);
+    return output;
+}
+
+struct Encoding {
+    std::string_view name;
+    std::string_view compression;           ///< @brief 为空且 base64 为 false 表示 csv
+    bool base64 = true;
+};
+
+/// @brief 把地图中所有瓦片层的数据改写为指定编码，失败（例如未启用 zstd）返回 false
+bool encode_layers(nlohmann::json& map_json, const Encoding& encoding) {
+    for (auto& layer : map_json["layers"]) {
+        if (layer.value("type", "") != "tilelayer" || !layer.contains("data") || !layer["data"].is_array()) continue;
+        std::vector<uint32_t> gids;
+        for (const auto& gid : layer["data"]) gids.push_back(gid.get<uint32_t>());
+        auto raw = std::as_bytes(std::span<const uint32_t>(gids));
+
+        std::vector<std::byte> payload;
+        if (encoding.compression.empty()) {
+            payload.assign(raw.begin(), raw.end());
+        } else if (encoding.compression == "zlib") {
+            payload = deflate_bytes(raw, 15);
+        } else if (encoding.compression == "gzip") {
+            payload = deflate_bytes(raw, 15 + 16);
+        } else {
+#ifdef ENGINE_HAS_ZSTD
+            payload.resize(ZSTD_compressBound(raw.size()));
+            payload.resize(ZSTD_compress(payload.data(), payload.size(), raw.data(), raw.size(), 19));
+#else
+            return false;
+#endif
+        }
+        layer["data"] = base64_encode(payload);
+        layer["encoding"] = "base64";
+        if (!encoding.compression.empty()) layer["compression"] = encoding.compression;
+    }
+    return true;
+}
+
+size_t count_tiles(const engine::scene::LevelData& level) {
+    size_t count = 0;
+    for (const auto& layer : level.layers) count += layer.tiles.size();
+    return count;
+}
+
+template<typename Func>
+double average_ms(Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) func();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / ITERATIONS;
+}
+
+void benchmark_map(const fs::path& map_path, engine::scene::TilesetRegistry& tilesets) {
+    auto map_key = map_path.generic_string();
+    auto file = AssetData::map_file(map_path);
+    if (!file) {
+        spdlog::error("无法打开地图 '{}'", map_key);
+        return;
+    }
+    nlohmann::json original;
+    try {
+        original = nlohmann::json::parse(file->text());
+    } catch (const nlohmann::json::parse_error& e) {
+        spdlog::error("解析地图 '{}' 失败：{}", map_key, e.what());
+        return;
+    }
+
+    // 地图从内存读取，其它文件（图块集）从磁盘读取
+    std::string map_text;
+    engine::scene::LevelParser parser([&](std::string_view path) -> std::optional<AssetData> {
+        if (path == map_key) return AssetData::view(std::as_bytes(std::span(map_text.data(), map_text.size())));
+        return AssetData::map_file(fs::path(path));
+    }, tilesets);
+
+    std::printf("=== %s ===\n", map_key.c_str());
+    size_t reference_tiles = 0;
+    const Encoding encodings[] = {
+        {"csv", "", false}, {"base64", ""}, {"base64+zlib", "zlib"}, {"base64+gzip", "gzip"}, {"base64+zstd", "zstd"}
+    };
+    for (const auto& encoding : encodings) {
+        auto map_json = original;
+        if (encoding.base64 && !encode_layers(map_json, encoding)) {
+            std::printf("%-12.*s 未启用，跳过\n", static_cast<int>(encoding.name.size()), encoding.name.data());
+            continue;
+        }
+        map_text = map_json.dump();
+        auto level = parser.parse(map_key);        // 预热（同时缓存图块集）并校验结果
+        if (!level) continue;
+        if (reference_tiles == 0) reference_tiles = count_tiles(level.value());
+        if (count_tiles(level.value()) != reference_tiles) spdlog::error("{} 解码结果与 csv 不一致", encoding.name);
+
+        auto ms = average_ms([&]() { [[maybe_unused]] auto result = parser.parse(map_key); });
+        std::printf("%-12.*s %9zu 字节  %8.3f ms\n", static_cast<int>(encoding.name.size()), encoding.name.data(), map_text.size(), ms);
+    }
+
+    // 二进制关卡：序列化当前解析结果后测量读取耗时
+    if (auto level = parser.parse(map_key)) {
+        auto bytes = engine::scene::level_format::write_level(level.value());
+        auto ms = average_ms([&]() { [[maybe_unused]] auto result = engine::scene::level_format::read_level(bytes); });
+        std::printf("%-12s %9zu 字节  %8.3f ms\n", "slvl", bytes.size(), ms);
+    }
+}
+/**
+ * @brief 生成合成地图：把源地图在水平、竖直方向各平铺 scale 次
+ *
+ * 有限地图的瓦片层按新尺寸平铺数据，对象层按偏移复制对象（重新分配 id），图片层与图块集引用不变。
+ * 输出与源地图位于同一目录，图块集的相对路径保持有效。
+ */
+bool write_synthetic_map(const fs::path& source_path, const fs::path& target_path, int scale) {
+    auto file = AssetData::map_file(source_path);
+    if (!file) {
+        spdlog::error("无法打开地图 '{}'", source_path.generic_string());
+        return false;
+    }
+    auto map_json = nlohmann::json::parse(file->text(), nullptr, false);
+    if (map_json.is_discarded() || map_json.value("infinite", false)) {
+        spdlog::error("地图 '{}' 无法解析或为无限地图，不能平铺", source_path.generic_string());
+        return false;
+    }
+
+    int width = map_json.value("width", 0);
+    int height = map_json.value("height", 0);
+    float offset_x = static_cast<float>(width * map_json.value("tilewidth", 0));
+    float offset_y = static_cast<float>(height * map_json.value("tileheight", 0));
+    int next_id = 1;
+    for (auto& layer : map_json["layers"]) {
+        auto type = layer.value("type", "");
+        if (type == "tilelayer" && layer.contains("data") && layer["data"].is_array()) {
+            const auto& data = layer["data"];
+            auto tiled = nlohmann::json::array();
+            for (int y = 0; y < height * scale; ++y) {
+                for (int x = 0; x < width * scale; ++x) tiled.push_back(data[static_cast<size_t>((y % height) * width + x % width)]);
+            }
+            layer["data"] = std::move(tiled);
+            layer["width"] = width * scale;
+            layer["height"] = height * scale;
+        } else if (type == "objectgroup" && layer.contains("objects")) {
+            auto copies = nlohmann::json::array();
+            for (int j = 0; j < scale; ++j) {
+                for (int i = 0; i < scale; ++i) {
+                    for (auto object : layer["objects"]) {
+                        object["id"] = next_id++;
+                        object["x"] = object.value("x", 0.f) + offset_x * static_cast<float>(i);
+                        object["y"] = object.value("y", 0.f) + offset_y * static_cast<float>(j);
+                        copies.push_back(std::move(object));
+                    }
+                }
+            }
+            layer["objects"] = std::move(copies);
+        }
+    }
+    map_json["width"] = width * scale;
+    map_json["height"] = height * scale;
+    map_json["nextobjectid"] = next_id;
+
+    std::ofstream out(target_path, std::ios::trunc);
+    out << map_json.dump();
+    if (!out) {
+        spdlog::error("无法写入合成地图 '{}'", target_path.generic_string());
+        return false;
+    }
+    return true;
+}
+
+/// @brief 不打开窗口的引擎子系统，只为构造 Context 与场景（成员顺序与 Game 相同：线程池比资源管理器活得久）
+struct HeadlessEngine {
+    engine::core::Config config{"assets/config.json"};
+    sf::RenderWindow window;                    // 未创建的窗口，只提供默认视图
+    engine::core::ThreadPool thread_pool;
+    engine::resource::ResourceManager resource_manager{&thread_pool};
+    engine::input::InputManager input_manager{&window, &config};
+    engine::render::Renderer renderer{&window, &resource_manager, nullptr, &thread_pool};
+    engine::render::Camera camera{&window};
+    engine::physics::PhysicsEngine physics_engine;
+    engine::audio::AudioPlayer audio_player{&resource_manager};
+    engine::core::GameState game_state{&window};
+    engine::scene::TilesetRegistry tileset_registry;
+    engine::core::Context context{input_manager, renderer, camera, resource_manager, physics_engine
+                                , audio_player, game_state, thread_pool, tileset_registry};
+    engine::scene::SceneManager scene_manager{context};
+};
+
+/// @brief 以串行/并行准备阶段分别多次加载地图，输出各阶段平均耗时
+void benchmark_load(HeadlessEngine& engine, const fs::path& map_path) {
+    auto map_key = map_path.generic_string();
+    engine::scene::LevelLoader loader(engine.context);
+    std::printf("=== %s ===\n", map_key.c_str());
+
+    double serial_prepare_ms = 0.0;
+    for (bool parallel : {false, true}) {
+        loader.set_parallel_prepare(parallel);
+        engine::scene::LevelLoader::LoadStats total;
+        for (int i = 0; i <= LOAD_ITERATIONS; ++i) {       // 第 0 次为预热（解析地图、解码纹理），不计时
+            engine::scene::Scene scene("benchmark", engine.context, engine.scene_manager);
+            if (!loader.load_level(map_key, scene)) {
+                spdlog::error("加载地图 '{}' 失败", map_key);
+                return;
+            }
+            if (i == 0) continue;
+            const auto& stats = loader.get_last_stats();
+            total.task_count = stats.task_count;
+            total.prepare_ms += stats.prepare_ms;
+            total.insert_ms += stats.insert_ms;
+        }
+        auto prepare_ms = total.prepare_ms / LOAD_ITERATIONS;
+        auto insert_ms = total.insert_ms / LOAD_ITERATIONS;
+        if (!parallel) serial_prepare_ms = prepare_ms;
+        std::printf("%-4s %5zu 个任务  准备 %8.3f ms  插入 %8.3f ms  准备加速比 %.2fx\n", parallel ? "并行" : "串行"
+                   , total.task_count, prepare_ms, insert_ms, serial_prepare_ms / prepare_ms);
+    }
+}
+
+int run_load_benchmark(int argc, char* argv[]) {
+    int scale = 8;
+    std::vector<fs::path> maps;
+    for (int i = 2; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--scale" && i + 1 < argc) {
+            std::string_view value = argv[++i];
+            if (std::from_chars(value.data(), value.data() + value.size(), scale).ec != std::errc{} || scale < 1) {
+                spdlog::error("无效的平铺倍数 '{}'", value);
+                return 1;
+            }
+            continue;
+        }
+        maps.emplace_back(arg);
+    }
+    bool synthetic = maps.empty();
+    if (synthetic) {
+        if (!write_synthetic_map(LOAD_DEFAULT_MAP, SYNTHETIC_MAP, scale)) return 1;
+        maps = {fs::path(LOAD_DEFAULT_MAP), fs::path(SYNTHETIC_MAP)};
+    }
+
+    spdlog::set_level(spdlog::level::warn);     // 加载过程中的 info 日志会干扰计时
+    {
+        HeadlessEngine engine;
+        std::printf("线程池 %zu 个工作线程，每种准备方式加载 %d 次\n", engine.thread_pool.get_thread_count(), LOAD_ITERATIONS);
+        if (synthetic) std::printf("合成地图：level_1 在两个方向各平铺 %d 次\n", scale);
+        for (const auto& map : maps) {
+            benchmark_load(engine, map);
+        }
+    }
+    if (synthetic) {
+        std::error_code ec;
+        fs::remove(SYNTHETIC_MAP, ec);
+    }
+    return 0;
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string_view(argv[1]) == "--load") {
+        return run_load_benchmark(argc, argv);
+    }
+
+    std::vector<fs::path> maps;
+    for (int i = 1; i < argc; ++i) maps.emplace_back(argv[i]);
+    if (maps.empty()) {
+        std::error_code ec;
+        for (const auto& entry : fs::directory_iterator("assets/maps", ec)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".tmj") maps.push_back(entry.path());
+        }
+        std::ranges::sort(maps);
+    }
+    if (maps.empty()) {
+        spdlog::error("没有找到需要测试的地图");
+        return 1;
+    }
+
+    spdlog::set_level(spdlog::level::warn);     // 解析过程中的 info 日志会干扰计时
+    engine::scene::TilesetRegistry tilesets;
+    for (const auto& map : maps) {
+        benchmark_map(map, tilesets);
+    }
+    return 0;
+}
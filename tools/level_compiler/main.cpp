@@ -0,0 +1,79 @@
+/**
+ * @brief 关卡编译工具：把 Tiled 地图（.tmj + .tsj）编译为 LevelLoader 可直接映射读取的二进制关卡（.slvl）
+ *
+ * 用法（在项目根目录运行，使纹理与音效路径与游戏加载时使用的 "assets/..." 一致）：
+ *     level_compiler [地图文件.tmj ...]
+ * 不指定地图时编译 assets/maps 下的全部 .tmj。输出写在地图旁边，文件名相同、扩展名为 .slvl。
+ * 先运行本工具再运行 asset_packer，编译结果会一并打入资源包。
+ * 编译结果记录了地图与图块集的大小、修改时间与内容哈希，之后修改其中任何一个，游戏都会忽略旧的 .slvl 并改为解析 .tmj，重新运行本工具即可。
+ * 游戏加载时先比较大小与修改时间，只有不一致时才读取源文件比较哈希。
+ */
+#include "level_parser.hpp"
+#include "level_format.hpp"
+#include "asset_archive.hpp"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+namespace fs = std::filesystem;
+
+bool compile_level(const fs::path& map_path, engine::scene::TilesetRegistry& tilesets) {
+    engine::scene::LevelParser parser([](std::string_view path) {
+        return engine::resource::AssetData::map_file(fs::path(path));
+    }, tilesets);
+    auto level = parser.parse(map_path.generic_string());
+    if (!level) return false;
+
+    // 记录源文件的大小与修改时间，LevelLoader 据此判断源文件未变时不必重新读取并计算哈希
+    for (auto& dependency : level->dependencies) {
+        std::error_code size_error, time_error;
+        auto size = fs::file_size(dependency.path, size_error);
+        auto time = fs::last_write_time(dependency.path, time_error);
+        if (size_error || time_error) continue;
+        dependency.file_size = static_cast<uint64_t>(size);
+        dependency.file_time = static_cast<int64_t>(time.time_since_epoch().count());
+    }
+
+    auto bytes = engine::scene::level_format::write_level(level.value());
+    auto output_path = fs::path(map_path).replace_extension(engine::scene::level_format::EXTENSION);
+    std::ofstream out(output_path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open() || !out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) {
+        spdlog::error("无法写入 '{}'", output_path.string());
+        return false;
+    }
+    spdlog::info("'{}' -> '{}'：{} 个图层，{} 个纹理，{} 字节", map_path.generic_string(), output_path.generic_string()
+                , level->layers.size(), level->textures.size(), bytes.size());
+    return true;
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<fs::path> maps;
+    for (int i = 1; i < argc; ++i) maps.emplace_back(argv[i]);
+    if (maps.empty()) {
+        std::error_code ec;
+        for (const auto& entry : fs::directory_iterator("assets/maps", ec)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".tmj") maps.push_back(entry.path());
+        }
+        std::ranges::sort(maps);
+    }
+    if (maps.empty()) {
+        spdlog::error("没有找到需要编译的地图");
+        return 1;
+    }
+
+    engine::scene::TilesetRegistry tilesets;       // 各地图共用的图块集只解析一次
+    int failed = 0;
+    for (const auto& map : maps) {
+        if (!compile_level(map, tilesets)) ++failed;
+    }
+    if (failed > 0) {
+        spdlog::error("{} 个地图编译失败", failed);
+        return 1;
+    }
+    return 0;
+}